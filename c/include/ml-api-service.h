@@ -150,6 +150,7 @@ int ml_service_new (const char *config, ml_service_h *handle);
 /**
  * @brief Sets the callback which will be invoked when a new event occurs from machine learning service.
  * @since_tizen 9.0
+ * @remarks The callback may be invoked in the other threads. If ml-service offloading is configured with "workers" above 0, the callback is invoked in the worker threads concurrently for different service keys. Thus, the callback should be thread-safe.
  * @param[in] handle The handle of ml-service.
  * @param[in] cb The callback to handle the event from ml-service.
  * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
@@ -26,6 +26,154 @@ extern "C" {
  * Temporarily use the API waiting for release.
  */
 
+/**
+ * @brief Enumeration for the priority of the request in machine learning service.
+ */
+typedef enum {
+  ML_SERVICE_REQUEST_PRIORITY_LOW = 0,      /**< Background or bulk request. */
+  ML_SERVICE_REQUEST_PRIORITY_NORMAL = 1,   /**< Default priority, same as ml_service_request(). */
+  ML_SERVICE_REQUEST_PRIORITY_HIGH = 2,     /**< Latency-sensitive request. */
+
+  ML_SERVICE_REQUEST_PRIORITY_MAX
+} ml_service_request_priority_e;
+
+/**
+ * @brief Adds an input data with priority and deadline to process the model in machine learning service.
+ * @details The queued requests are processed in order of priority, then deadline.
+ *          If the deadline of the request has already passed when it is dequeued, the request is dropped without running the model.
+ *          If the queue is full (see the information 'max_input'), the request replaces the queued request of the lowest priority if that priority is lower than @a priority. The replaced request is counted as dropped.
+ *          The per-priority queue depth and latency are available with ml_service_get_information(), see below keys.
+ *          (queue_depth_<class>, processed_<class>, dropped_<class>, latency_avg_<class>, latency_max_<class>, class is one of low, normal, and high. The latency is in microseconds.)
+ * @param[in] handle The handle of ml-service.
+ * @param[in] name The name of input node in the pipeline. You can set NULL if ml-service is constructed from model configuration.
+ * @param[in] data The handle of tensors data to be processed.
+ * @param[in] priority The priority of the request.
+ * @param[in] deadline The deadline of the request from now, in milliseconds. Set 0 if the request has no deadline.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to process the input data.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_service_request_with_priority (ml_service_h handle, const char *name, const ml_tensors_data_h data, ml_service_request_priority_e priority, unsigned int deadline);
+
+/**
+ * @brief Requests to reload the activated model of machine learning service.
+ * @details If ml-service is constructed from the configuration with model key, ml-service opens the activated model of the key in background.
+ *          When the new model is ready, ml-service replaces the model between the requests and closes the old model, so the queued requests are not dropped.
+ *          The information 'reload_interval' (in milliseconds) makes ml-service check the activated model periodically.
+ *          The information 'model_path' gives the path of the model in use, which is changed when the reload is done.
+ * @param[in] handle The handle of ml-service.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or ml-service is not constructed with model key.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid.
+ */
+int ml_service_reload (ml_service_h handle);
+
+/**
+ * @brief Callback for the output of the asynchronous query request.
+ * @remarks The @a output can be used only in the callback. To use outside, make a copy.
+ * @param[in] status #ML_ERROR_NONE if the output is received, #ML_ERROR_TIMED_OUT if the query service does not respond in time.
+ * @param[in] output The handle of output tensors. NULL if @a status is not #ML_ERROR_NONE.
+ * @param[in] user_data Private data passed to ml_service_query_request_async().
+ */
+typedef void (*ml_service_query_cb) (int status, const ml_tensors_data_h output, void *user_data);
+
+/**
+ * @brief Requests the query service to process the @a input asynchronously.
+ * @details The function returns right after sending the @a input, and ml-service invokes @a cb in its own thread with the output or timeout error.
+ *          The callbacks are invoked in order of the outputs received. With several query servers, the order may differ from the order of the requests, use @a user_data to identify the request.
+ *          The option 'max-outstanding' (unsigned int) of ml_service_query_create() limits the number of requests waiting for the output. 0 (default) means unlimited.
+ *          The requests to a query server are serialized on its connection, the request is sent after the previous one is responded or timed out. The timeout of the request includes this waiting time, and the request which times out before it is sent is dropped without sending it.
+ *          With the option 'endpoints' (string, comma-separated list of host:port) of ml_service_query_create(), ml-service sends each request to the server with the fewest outstanding requests, then the lowest moving-average latency, and sends the timed-out request to other server.
+ *          The server which does not respond several times in a row is regarded as unhealthy. ml-service sends a request to the unhealthy server again after a back-off interval (1 second, doubled up to 32 seconds) to check whether it is recovered.
+ *          The statistics of each server are available with ml_service_get_information(), see below keys.
+ *          (endpoint_count, endpoint_<index>, outstanding_<index>, requests_<index>, responses_<index>, timeouts_<index>, latency_avg_<index>. The latency is in microseconds.)
+ * @remarks The @a cb is not invoked for the requests waiting for the output when the @a handle is destroyed. Do not destroy the @a handle in the callback.
+ * @param[in] handle The query service handle created by ml_service_query_create().
+ * @param[in] input The handle of input tensors.
+ * @param[in] cb The callback to get the output.
+ * @param[in] user_data Private data for the callback.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #ML_ERROR_STREAMS_PIPE The input is incompatible with the pipeline.
+ * @retval #ML_ERROR_TRY_AGAIN The number of outstanding requests exceeds 'max-outstanding'.
+ */
+int ml_service_query_request_async (ml_service_h handle, const ml_tensors_data_h input, ml_service_query_cb cb, void *user_data);
+
+/**
+ * @brief Gets the information of activated neural network models with given @a names at once.
+ * @details The information from ml-service agent is cached for a short time (2 seconds), and the cache is updated when the model is changed with ML Service API in this process.
+ *          The information not in the cache is fetched concurrently, so that the caller does not wait for each request to ml-service agent in order.
+ * @remarks The @a info should be an array of @a count handles. If the function succeeds, each @a info should be released using ml_information_destroy().
+ * @param[in] names The array of unique names to indicate the models.
+ * @param[in] count The number of the names.
+ * @param[out] info The array of handles to get the information of each activated model, in order of @a names.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or there is no activated model of the name.
+ * @retval #ML_ERROR_IO_ERROR The operation of DB or filesystem has failed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_service_model_get_activated_multi (const char **names, const unsigned int count, ml_information_h *info);
+
+/**
+ * @brief Gets the pipeline descriptions with given @a names at once.
+ * @details The descriptions are cached and fetched concurrently, same as ml_service_model_get_activated_multi().
+ * @remarks The @a pipeline_desc should be an array of @a count strings. If the function succeeds, each @a pipeline_desc should be released using free().
+ * @param[in] names The array of unique names to indicate the pipelines.
+ * @param[in] count The number of the names.
+ * @param[out] pipeline_desc The array of strings to get the pipeline description, in order of @a names.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or there is no pipeline of the name.
+ * @retval #ML_ERROR_IO_ERROR The operation of DB or filesystem has failed.
+ */
+int ml_service_pipeline_get_multi (const char **names, const unsigned int count, char **pipeline_desc);
+
+/**
+ * @brief Sets the number of pre-launched pipelines of the service.
+ * @details ML Service API launches the pipelines of given @a name in background and keeps them in PAUSED state, with the models loaded.
+ *          Then ml_service_pipeline_launch() takes the pipeline from the pool and refills the pool in background, so that the caller only starts the pipeline.
+ *          The pre-launched pipelines are destroyed when the pipeline description is changed or deleted.
+ * @remarks The pre-launched pipelines are not released when the application exits. Set 0 or call ml_service_pipeline_clear_pools() to destroy them before the application exits.
+ * @param[in] name The unique name of the registered pipeline.
+ * @param[in] size The number of pipelines to be kept in the pool, 0 to disable the pool. The max size is 8.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or the pipeline is not registered.
+ */
+int ml_service_pipeline_set_pool_size (const char *name, const unsigned int size);
+
+/**
+ * @brief Gets the number of pre-launched pipelines ready in the pool of the service.
+ * @details The pipelines are launched in background after ml_service_pipeline_set_pool_size() or ml_service_pipeline_launch(), the number increases until the pool is full.
+ * @param[in] name The unique name of the registered pipeline.
+ * @param[out] count The number of pre-launched pipelines in the pool, 0 if the pool is disabled.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_service_pipeline_get_pool_available (const char *name, unsigned int *count);
+
+/**
+ * @brief Destroys the pre-launched pipelines of all services, and disables the pools.
+ * @details The pipelines in the pool are launched in ml-service agent, these are not released when the application exits.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ */
+int ml_service_pipeline_clear_pools (void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
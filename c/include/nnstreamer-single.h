@@ -265,6 +265,8 @@ int ml_single_set_input_info (ml_single_h single, const ml_tensors_info_h info);
 
 /**
  * @brief Sets the maximum amount of time to wait for an output, in milliseconds.
+ * @details Note that the model cannot be interrupted. If the invoke has started and the time is over, the invoke returns #ML_ERROR_TIMED_OUT but the model keeps running until it returns, and its output is discarded.
+ *          Until the running invoke is done, invoking the handle returns #ML_ERROR_TRY_AGAIN.
  * @since_tizen 5.5
  * @param[in] single The model handle.
  * @param[in] timeout The time to wait for an output.
@@ -61,6 +61,73 @@ void ml_api_get_version (unsigned int *major, unsigned int *minor, unsigned int
  */
 char * ml_api_get_version_string (void);
 
+/**
+ * @brief Gets the invoke latency statistics of the single-shot handle.
+ * @details The handle keeps the histogram of the latency for each step of the invoke. The returned information has below keys, the value is a string in microseconds.
+ *          (count, <step>_p50, <step>_p90, <step>_p99, <step>_max, <step>_avg, step is one of lock, input, invoke, output, and total.)
+ *          The percentiles are the upper bound of the histogram bucket, which has at most 1/8 relative error.
+ * @since_tizen 10.0
+ * @remarks The @a info should be released using ml_information_destroy().
+ * @param[in] single The model handle.
+ * @param[out] info The handle of statistics.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_get_statistics (ml_single_h single, ml_information_h *info);
+
+/**
+ * @brief Resets the invoke latency statistics of the single-shot handle.
+ * @since_tizen 10.0
+ * @param[in] single The model handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_reset_statistics (ml_single_h single);
+
+/**
+ * @brief Invokes the models with the same input data concurrently.
+ * @details The requests share one copy of the read-only input data and run in the worker pool of single-shot.
+ *          This function returns when all models are invoked or the @a timeout expires.
+ *          If a request is not started until the @a timeout, the request is cancelled. If a request is running, its output is dropped and the handle returns #ML_ERROR_TRY_AGAIN until the request is done.
+ * @since_tizen 10.0
+ * @remarks If the function succeeds, each @a output should be released using ml_tensors_data_destroy(). If the function fails, the @a output is not allocated.
+ * @param[in] single The array of model handles. A handle should not be duplicated in the array.
+ * @param[in] count The number of the model handles.
+ * @param[in] input The input data to be inferred with all models.
+ * @param[out] output The array of @a count output data, in order of @a single.
+ * @param[in] timeout The time to wait for all models in milliseconds, 0 to wait until done.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid, or the input is not valid for some model.
+ * @retval #ML_ERROR_STREAMS_PIPE Cannot push the request or failed to invoke some model.
+ * @retval #ML_ERROR_TRY_AGAIN Some model handle is busy with the previous request.
+ * @retval #ML_ERROR_TIMED_OUT Failed to get the result of some model within the @a timeout.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_invoke_multi (ml_single_h *single, const unsigned int count, const ml_tensors_data_h input, ml_tensors_data_h *output, const unsigned int timeout);
+
+/**
+ * @brief Sets the scheduling attributes of the streaming threads in the pipeline.
+ * @details The @a option has string values with below keys. The attributes are applied to the running streaming threads and the threads entering the pipeline later.
+ *          (cpu_affinity: list of CPUs e.g., "0-3,6", nice: -20 ~ 19, sched_policy: one of other, fifo and rr, sched_priority: 1 ~ 99 for fifo and rr, thread_name: up to 15 characters)
+ *          The same keys are available in ml_single_open_with_option(), and ml_single_set_property() with '-' instead of '_' (e.g., cpu-affinity). The single-shot handle with these attributes invokes the model in the worker thread.
+ * @since_tizen 10.0
+ * @param[in] pipe The pipeline handle.
+ * @param[in] option The handle of ml-option with the scheduling attributes.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the platform cannot set the attributes.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_PERMISSION_DENIED The process is not allowed to set the attribute (e.g., real-time policy without privilege).
+ */
+int ml_pipeline_set_thread_option (ml_pipeline_h pipe, ml_option_h option);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -10,10 +10,22 @@
  * @bug No known bugs except for NYI items
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <errno.h>
 #include <glib.h>
+#if defined (__linux__)
+#include <sched.h>
+#include <unistd.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
 #include <nnstreamer_plugin_api_util.h>
 #include "nnstreamer.h"
 #include "nnstreamer-tizen-internal.h"
@@ -1798,3 +1810,477 @@ ml_information_list_get (ml_information_list_h list, unsigned int index,
 
   return ML_ERROR_NONE;
 }
+
+/**
+ * @brief The max length of the thread name (excluding null terminator).
+ */
+#define ML_THREAD_NAME_MAX 15
+
+/**
+ * @brief The max number of CPUs in the CPU list.
+ */
+#define ML_THREAD_CPU_MAX 1024
+
+/**
+ * @brief The keys of the scheduling attributes.
+ */
+static const char *ml_thread_attr_keys[] = {
+  "cpu_affinity", "nice", "sched_policy", "sched_priority", "thread_name", NULL
+};
+
+/**
+ * @brief Internal function to get the index of the scheduling attribute. The key with '-' (e.g., cpu-affinity) is also allowed.
+ */
+static gint
+_ml_thread_attr_get_key_index (const char *key)
+{
+  g_autofree gchar *_key = NULL;
+  gint i;
+
+  if (!STR_IS_VALID (key))
+    return -1;
+
+  _key = g_strdelimit (g_strdup (key), "-", '_');
+
+  for (i = 0; ml_thread_attr_keys[i]; i++) {
+    if (g_ascii_strcasecmp (_key, ml_thread_attr_keys[i]) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Internal function to parse the list of CPUs (e.g., "0-3,6"). If @a cpus is given, set the CPU in the array.
+ */
+static gboolean
+_ml_thread_parse_cpu_list (const gchar * list, gboolean * cpus)
+{
+  g_auto (GStrv) ranges = NULL;
+  guint i, n;
+  guint64 first, last, c;
+
+  if (!STR_IS_VALID (list))
+    return FALSE;
+
+  ranges = g_strsplit (list, ",", -1);
+  n = g_strv_length (ranges);
+
+  for (i = 0; i < n; i++) {
+    g_auto (GStrv) bound = g_strsplit (g_strstrip (ranges[i]), "-", 2);
+
+    if (!g_ascii_string_to_unsigned (g_strstrip (bound[0]), 10, 0,
+            ML_THREAD_CPU_MAX - 1, &first, NULL))
+      return FALSE;
+
+    last = first;
+    if (bound[1] && !g_ascii_string_to_unsigned (g_strstrip (bound[1]), 10,
+            first, ML_THREAD_CPU_MAX - 1, &last, NULL))
+      return FALSE;
+
+    if (cpus) {
+      for (c = first; c <= last; c++)
+        cpus[c] = TRUE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Sets the scheduling attribute of given key.
+ */
+int
+_ml_thread_attr_set (ml_thread_attr_s * attr, const char *key,
+    const char *value)
+{
+  gint64 num;
+
+  if (!attr) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'attr' is NULL. It should be a valid ml_thread_attr_s.");
+  }
+
+  switch (_ml_thread_attr_get_key_index (key)) {
+    case 0:
+      /* cpu_affinity, empty string resets the CPU mask. */
+      if (STR_IS_VALID (value) && !_ml_thread_parse_cpu_list (value, NULL)) {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The value of cpu_affinity, '%s', is invalid. It should be the list of CPUs, e.g., '0-3,6'.",
+            value);
+      }
+
+      g_free (attr->cpu_affinity);
+      attr->cpu_affinity = STR_IS_VALID (value) ? g_strdup (value) : NULL;
+      break;
+    case 1:
+      /* nice */
+      if (!STR_IS_VALID (value)) {
+        attr->has_nice = FALSE;
+        break;
+      }
+
+      if (!g_ascii_string_to_signed (value, 10, -20, 19, &num, NULL)) {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The value of nice, '%s', is invalid. It should be an integer between -20 and 19.",
+            value);
+      }
+
+      attr->has_nice = TRUE;
+      attr->nice = (gint) num;
+      break;
+    case 2:
+      /* sched_policy */
+      if (!STR_IS_VALID (value)) {
+        attr->has_policy = FALSE;
+      } else if (g_ascii_strcasecmp (value, "other") == 0) {
+        attr->has_policy = TRUE;
+        attr->policy = ML_THREAD_POLICY_DEFAULT;
+      } else if (g_ascii_strcasecmp (value, "fifo") == 0) {
+        attr->has_policy = TRUE;
+        attr->policy = ML_THREAD_POLICY_FIFO;
+      } else if (g_ascii_strcasecmp (value, "rr") == 0) {
+        attr->has_policy = TRUE;
+        attr->policy = ML_THREAD_POLICY_RR;
+      } else {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The value of sched_policy, '%s', is invalid. It should be one of {other, fifo, rr}.",
+            value);
+      }
+      break;
+    case 3:
+      /* sched_priority */
+      if (!STR_IS_VALID (value)) {
+        attr->priority = 0;
+        break;
+      }
+
+      if (!g_ascii_string_to_signed (value, 10, 1, 99, &num, NULL)) {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The value of sched_priority, '%s', is invalid. It should be an integer between 1 and 99.",
+            value);
+      }
+
+      attr->priority = (gint) num;
+      break;
+    case 4:
+      /* thread_name */
+      g_free (attr->name);
+      attr->name = STR_IS_VALID (value) ?
+          g_strndup (value, ML_THREAD_NAME_MAX) : NULL;
+      break;
+    default:
+      return ML_ERROR_NOT_SUPPORTED;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the scheduling attributes from the string values in ml_option instance.
+ */
+int
+_ml_thread_attr_set_from_option (ml_thread_attr_s * attr, ml_option_h option)
+{
+  void *value;
+  gint i;
+  int status;
+
+  for (i = 0; ml_thread_attr_keys[i]; i++) {
+    if (ML_ERROR_NONE == ml_option_get (option, ml_thread_attr_keys[i], &value)) {
+      status = _ml_thread_attr_set (attr, ml_thread_attr_keys[i],
+          (const char *) value);
+      if (status != ML_ERROR_NONE)
+        return status;
+    }
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the scheduling attribute of given key as a newly allocated string.
+ */
+int
+_ml_thread_attr_get (const ml_thread_attr_s * attr, const char *key,
+    char **value)
+{
+  if (!attr || !value) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'attr' or 'value' is NULL.");
+  }
+
+  switch (_ml_thread_attr_get_key_index (key)) {
+    case 0:
+      *value = g_strdup (attr->cpu_affinity ? attr->cpu_affinity : "");
+      break;
+    case 1:
+      *value = attr->has_nice ? g_strdup_printf ("%d", attr->nice) : g_strdup ("");
+      break;
+    case 2:
+      if (!attr->has_policy)
+        *value = g_strdup ("");
+      else if (attr->policy == ML_THREAD_POLICY_FIFO)
+        *value = g_strdup ("fifo");
+      else if (attr->policy == ML_THREAD_POLICY_RR)
+        *value = g_strdup ("rr");
+      else
+        *value = g_strdup ("other");
+      break;
+    case 3:
+      *value = (attr->priority > 0) ?
+          g_strdup_printf ("%d", attr->priority) : g_strdup ("");
+      break;
+    case 4:
+      *value = g_strdup (attr->name ? attr->name : "");
+      break;
+    default:
+      return ML_ERROR_NOT_SUPPORTED;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Checks whether any scheduling attribute is set.
+ */
+gboolean
+_ml_thread_attr_is_set (const ml_thread_attr_s * attr)
+{
+  if (!attr)
+    return FALSE;
+
+  return (attr->cpu_affinity || attr->has_nice || attr->has_policy ||
+      attr->name);
+}
+
+/**
+ * @brief Copies the scheduling attributes.
+ */
+void
+_ml_thread_attr_copy (ml_thread_attr_s * dest, const ml_thread_attr_s * src)
+{
+  if (!dest || !src || dest == src)
+    return;
+
+  _ml_thread_attr_clear (dest);
+
+  *dest = *src;
+  dest->cpu_affinity = g_strdup (src->cpu_affinity);
+  dest->name = g_strdup (src->name);
+}
+
+/**
+ * @brief Releases the scheduling attributes and resets it to the default.
+ */
+void
+_ml_thread_attr_clear (ml_thread_attr_s * attr)
+{
+  if (!attr)
+    return;
+
+  g_free (attr->cpu_affinity);
+  g_free (attr->name);
+  memset (attr, 0, sizeof (ml_thread_attr_s));
+}
+
+/**
+ * @brief Gets the id of the calling thread, to apply the scheduling attributes from other thread.
+ */
+int
+_ml_thread_get_id (void)
+{
+#if defined (__linux__)
+  return (int) syscall (SYS_gettid);
+#else
+  return 0;
+#endif
+}
+
+#if defined (__linux__)
+/**
+ * @brief Internal function to convert errno to ml-api error code.
+ */
+static int
+_ml_thread_errno_to_error (int err)
+{
+  return (err == EPERM || err == EACCES) ?
+      ML_ERROR_PERMISSION_DENIED : ML_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Internal function to get the list of CPUs in the CPU mask.
+ */
+static gchar *
+_ml_thread_cpu_set_to_string (const cpu_set_t * set)
+{
+  GString *list = g_string_new (NULL);
+  gint c, first = -1;
+
+  for (c = 0; c <= CPU_SETSIZE; c++) {
+    gboolean isset = (c < CPU_SETSIZE && CPU_ISSET (c, set));
+
+    if (isset && first < 0) {
+      first = c;
+    } else if (!isset && first >= 0) {
+      if (list->len > 0)
+        g_string_append_c (list, ',');
+
+      if (first == c - 1)
+        g_string_append_printf (list, "%d", first);
+      else
+        g_string_append_printf (list, "%d-%d", first, c - 1);
+
+      first = -1;
+    }
+  }
+
+  return g_string_free (list, FALSE);
+}
+#endif
+
+/**
+ * @brief Applies the scheduling attributes to the thread.
+ */
+int
+_ml_thread_attr_apply (const ml_thread_attr_s * attr, int tid,
+    ml_thread_attr_s * saved)
+{
+  int status = ML_ERROR_NONE;
+
+  if (!attr) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'attr' is NULL. It should be a valid ml_thread_attr_s.");
+  }
+
+  if (saved)
+    memset (saved, 0, sizeof (ml_thread_attr_s));
+
+  if (!_ml_thread_attr_is_set (attr))
+    return ML_ERROR_NONE;
+
+#if defined (__linux__)
+  if (attr->cpu_affinity) {
+    g_autofree gboolean *cpus = g_new0 (gboolean, ML_THREAD_CPU_MAX);
+    cpu_set_t set;
+    gint c;
+
+    if (saved && sched_getaffinity (tid, sizeof (cpu_set_t), &set) == 0)
+      saved->cpu_affinity = _ml_thread_cpu_set_to_string (&set);
+
+    CPU_ZERO (&set);
+    _ml_thread_parse_cpu_list (attr->cpu_affinity, cpus);
+    for (c = 0; c < ML_THREAD_CPU_MAX && c < CPU_SETSIZE; c++) {
+      if (cpus[c])
+        CPU_SET (c, &set);
+    }
+
+    if (sched_setaffinity (tid, sizeof (cpu_set_t), &set) != 0) {
+      status = _ml_thread_errno_to_error (errno);
+      _ml_error_report
+          ("Failed to set the CPU affinity '%s' of the thread: %s.",
+          attr->cpu_affinity, g_strerror (errno));
+    }
+  }
+
+  if (attr->has_policy) {
+    struct sched_param param = { 0 };
+    int policy;
+
+    if (saved) {
+      policy = sched_getscheduler (tid);
+
+      if ((policy == SCHED_OTHER || policy == SCHED_FIFO ||
+              policy == SCHED_RR) && sched_getparam (tid, &param) == 0) {
+        saved->has_policy = TRUE;
+        saved->policy = (policy == SCHED_FIFO) ? ML_THREAD_POLICY_FIFO :
+            (policy == SCHED_RR) ? ML_THREAD_POLICY_RR :
+            ML_THREAD_POLICY_DEFAULT;
+        saved->priority = param.sched_priority;
+      }
+    }
+
+    switch (attr->policy) {
+      case ML_THREAD_POLICY_FIFO:
+        policy = SCHED_FIFO;
+        param.sched_priority = MAX (attr->priority, 1);
+        break;
+      case ML_THREAD_POLICY_RR:
+        policy = SCHED_RR;
+        param.sched_priority = MAX (attr->priority, 1);
+        break;
+      default:
+        policy = SCHED_OTHER;
+        param.sched_priority = 0;
+        break;
+    }
+
+    if (sched_setscheduler (tid, policy, &param) != 0) {
+      status = _ml_thread_errno_to_error (errno);
+      _ml_error_report
+          ("Failed to set the scheduling policy (%d) and priority (%d) of the thread: %s.",
+          policy, param.sched_priority, g_strerror (errno));
+    }
+  }
+
+  /* The nice value is per-thread in Linux. Set it after the policy, it is used for the time-sharing policy. */
+  if (attr->has_nice) {
+    int id = (tid != 0) ? tid : _ml_thread_get_id ();
+    int prio;
+
+    if (saved) {
+      errno = 0;
+      prio = getpriority (PRIO_PROCESS, id);
+      if (errno == 0) {
+        saved->has_nice = TRUE;
+        saved->nice = prio;
+      }
+    }
+
+    if (setpriority (PRIO_PROCESS, id, attr->nice) != 0) {
+      status = _ml_thread_errno_to_error (errno);
+      _ml_error_report ("Failed to set the nice value (%d) of the thread: %s.",
+          attr->nice, g_strerror (errno));
+    }
+  }
+
+  if (attr->name) {
+    if (tid == 0) {
+      char name[ML_THREAD_NAME_MAX + 1] = { 0 };
+
+      if (saved && prctl (PR_GET_NAME, name, 0, 0, 0) == 0)
+        saved->name = g_strdup (name);
+
+      if (prctl (PR_SET_NAME, attr->name, 0, 0, 0) != 0) {
+        status = _ml_thread_errno_to_error (errno);
+        _ml_error_report ("Failed to set the name '%s' of the thread: %s.",
+            attr->name, g_strerror (errno));
+      }
+    } else {
+      g_autofree gchar *path = g_strdup_printf ("/proc/self/task/%d/comm", tid);
+      gchar *name = NULL;
+      FILE *fp;
+
+      if (saved && g_file_get_contents (path, &name, NULL, NULL))
+        saved->name = g_strstrip (name);
+
+      fp = fopen (path, "w");
+
+      if (!fp || fputs (attr->name, fp) < 0) {
+        status = _ml_thread_errno_to_error (errno);
+        _ml_error_report ("Failed to set the name '%s' of the thread %d: %s.",
+            attr->name, tid, g_strerror (errno));
+      }
+
+      if (fp)
+        fclose (fp);
+    }
+  }
+#else
+  status = ML_ERROR_NOT_SUPPORTED;
+  _ml_error_report
+      ("The scheduling attributes of the thread are not supported in this platform.");
+#endif
+
+  return status;
+}
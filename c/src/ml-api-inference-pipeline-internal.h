@@ -129,6 +129,10 @@ typedef struct _ml_pipeline {
   GHashTable *resources;          /**< hash table of resources to construct the pipeline */
   GHashTable *pipe_elm_type;      /**< hash table for type of pipeline element */
   pipeline_state_cb_s state_cb;   /**< Callback to notify the change of pipeline state */
+
+  GMutex thread_lock;             /**< Lock for the scheduling attributes of streaming threads */
+  ml_thread_attr_s thread_attr;   /**< The scheduling attributes of streaming threads */
+  GHashTable *threads;            /**< hash table of streaming threads (thread id and the attributes before entering the pipeline) */
 } ml_pipeline;
 
 /**
@@ -208,6 +212,28 @@ GstElement* _ml_pipeline_get_gst_pipeline (ml_pipeline_h pipe);
  */
 GstElement* _ml_pipeline_get_gst_element (ml_pipeline_element_h handle);
 
+/**
+ * @brief Pushes a data frame to a src with the offset of the buffer.
+ * @details The offset is passed to the elements in pipeline, to identify the data frame (e.g., sequence number of the request).
+ */
+int _ml_pipeline_src_input_data_with_offset (ml_pipeline_src_h h, ml_tensors_data_h data, ml_pipeline_buf_policy_e policy, guint64 offset);
+
+/**
+ * @brief Gets the registered tensor_if custom condition of given name, the condition cannot be unregistered until it is released.
+ * @return The handle of tensor_if custom condition. Null if the condition is not registered.
+ */
+ml_pipeline_if_h _ml_pipeline_if_custom_get (const char *name);
+
+/**
+ * @brief Releases the tensor_if custom condition from _ml_pipeline_if_custom_get().
+ */
+void _ml_pipeline_if_custom_release (ml_pipeline_if_h if_custom);
+
+/**
+ * @brief Invokes the callback of tensor_if custom condition with given data.
+ */
+int _ml_pipeline_if_custom_invoke (ml_pipeline_if_h if_custom, const ml_tensors_data_h data, const ml_tensors_info_h info, int *result);
+
 #if defined (__TIZEN__)
 /****** TIZEN PRIVILEGE CHECK BEGINS ******/
 /**
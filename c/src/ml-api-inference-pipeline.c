@@ -461,6 +461,81 @@ cb_appsink_new_sample (GstElement * e, gpointer user_data)
   return GST_FLOW_OK;
 }
 
+/**
+ * @brief Internal function to release the attributes of streaming thread.
+ */
+static void
+free_thread_attr (gpointer data)
+{
+  ml_thread_attr_s *attr = (ml_thread_attr_s *) data;
+
+  _ml_thread_attr_clear (attr);
+  g_free (attr);
+}
+
+/**
+ * @brief Internal function to keep the original attributes of the streaming thread, which are not saved yet.
+ * @note The attributes already saved are kept, these are the attributes before the thread entered the pipeline.
+ */
+static void
+merge_thread_attr (ml_thread_attr_s * saved, ml_thread_attr_s * prev)
+{
+  if (!saved->cpu_affinity) {
+    saved->cpu_affinity = prev->cpu_affinity;
+    prev->cpu_affinity = NULL;
+  }
+
+  if (!saved->has_nice && prev->has_nice) {
+    saved->has_nice = TRUE;
+    saved->nice = prev->nice;
+  }
+
+  if (!saved->has_policy && prev->has_policy) {
+    saved->has_policy = TRUE;
+    saved->policy = prev->policy;
+    saved->priority = prev->priority;
+  }
+
+  if (!saved->name) {
+    saved->name = prev->name;
+    prev->name = NULL;
+  }
+}
+
+/**
+ * @brief Internal function to apply the scheduling attributes when the streaming thread enters the pipeline, and to restore it when the thread leaves.
+ * @note This is called in the streaming thread, the threads may be reused in the task pool of GStreamer.
+ */
+static void
+update_streaming_thread (ml_pipeline * pipe_h, GstStreamStatusType type)
+{
+  gpointer tid = GINT_TO_POINTER (_ml_thread_get_id ());
+  ml_thread_attr_s *saved;
+
+  g_mutex_lock (&pipe_h->thread_lock);
+
+  if (type == GST_STREAM_STATUS_TYPE_ENTER) {
+    saved = g_new0 (ml_thread_attr_s, 1);
+
+    if (_ml_thread_attr_is_set (&pipe_h->thread_attr) &&
+        _ml_thread_attr_apply (&pipe_h->thread_attr, 0, saved) != ML_ERROR_NONE) {
+      _ml_error_report
+          ("Failed to apply the scheduling attributes to the streaming thread of the pipeline.");
+    }
+
+    g_hash_table_insert (pipe_h->threads, tid, saved);
+  } else if (type == GST_STREAM_STATUS_TYPE_LEAVE) {
+    saved = g_hash_table_lookup (pipe_h->threads, tid);
+
+    if (saved && _ml_thread_attr_is_set (saved))
+      _ml_thread_attr_apply (saved, 0, NULL);
+
+    g_hash_table_remove (pipe_h->threads, tid);
+  }
+
+  g_mutex_unlock (&pipe_h->thread_lock);
+}
+
 /**
  * @brief Callback for bus message.
  */
@@ -478,6 +553,14 @@ cb_bus_sync_message (GstBus * bus, GstMessage * message, gpointer user_data)
     case GST_MESSAGE_EOS:
       pipe_h->isEOS = TRUE;
       break;
+    case GST_MESSAGE_STREAM_STATUS:
+    {
+      GstStreamStatusType type;
+
+      gst_message_parse_stream_status (message, &type, NULL);
+      update_streaming_thread (pipe_h, type);
+      break;
+    }
     case GST_MESSAGE_STATE_CHANGED:
       if (GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (pipe_h->element)) {
         GstState old_state, new_state;
@@ -1013,6 +1096,9 @@ construct_pipeline_internal (const char *pipeline_description,
         "ml_pipeline_construct error: failed to allocate memory for pipeline handle. Out of memory?");
 
   g_mutex_init (&pipe_h->lock);
+  g_mutex_init (&pipe_h->thread_lock);
+  pipe_h->threads = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+      NULL, free_thread_attr);
 
   pipe_h->isEOS = FALSE;
   pipe_h->pipe_state = ML_PIPELINE_STATE_UNKNOWN;
@@ -1196,10 +1282,70 @@ ml_pipeline_destroy (ml_pipeline_h pipe)
   g_mutex_unlock (&p->lock);
   g_mutex_clear (&p->lock);
 
+  g_hash_table_destroy (p->threads);
+  _ml_thread_attr_clear (&p->thread_attr);
+  g_mutex_clear (&p->thread_lock);
+
   g_free (p);
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Sets the scheduling attributes of the streaming threads in the pipeline (Tizen internal, see nnstreamer-tizen-internal.h)
+ */
+int
+ml_pipeline_set_thread_option (ml_pipeline_h pipe, ml_option_h option)
+{
+  ml_pipeline *p = pipe;
+  ml_thread_attr_s attr = { 0, };
+  GHashTableIter iter;
+  gpointer tid, saved;
+  int status, ret;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle instance, usually created by ml_pipeline_construct().");
+
+  if (option == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, option, is NULL. It should be a valid ml_option_h, which should be created by ml_option_create().");
+
+  status = _ml_thread_attr_set_from_option (&attr, option);
+  if (status != ML_ERROR_NONE) {
+    _ml_thread_attr_clear (&attr);
+    _ml_error_report_return (status,
+        "Failed to parse the scheduling attributes of the thread in the option.");
+  }
+
+  g_mutex_lock (&p->thread_lock);
+  _ml_thread_attr_copy (&p->thread_attr, &attr);
+
+  /* Apply the attributes to the streaming threads which are already running, and keep the original attributes to restore it when the thread leaves. */
+  g_hash_table_iter_init (&iter, p->threads);
+  while (g_hash_table_iter_next (&iter, &tid, &saved)) {
+    ml_thread_attr_s prev = { 0, };
+
+    ret = _ml_thread_attr_apply (&attr, GPOINTER_TO_INT (tid), &prev);
+    if (ret != ML_ERROR_NONE)
+      status = ret;
+
+    merge_thread_attr ((ml_thread_attr_s *) saved, &prev);
+    _ml_thread_attr_clear (&prev);
+  }
+  g_mutex_unlock (&p->thread_lock);
+
+  _ml_thread_attr_clear (&attr);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to apply the scheduling attributes to the streaming threads of the pipeline.");
+  }
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Get the pipeline state (more info in nnstreamer.h)
  */
@@ -1633,11 +1779,11 @@ ml_pipeline_src_release_handle (ml_pipeline_src_h h)
 }
 
 /**
- * @brief Push a data frame to a src (more info in nnstreamer.h)
+ * @brief Internal function to push a data frame to a src with the offset of the buffer.
  */
 int
-ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
-    ml_pipeline_buf_policy_e policy)
+_ml_pipeline_src_input_data_with_offset (ml_pipeline_src_h h,
+    ml_tensors_data_h data, ml_pipeline_buf_policy_e policy, guint64 offset)
 {
   GstBuffer *buffer;
   GstMemory *mem, *tmp;
@@ -1705,6 +1851,7 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
 
   /* Create buffer to be pushed from buf[] */
   buffer = gst_buffer_new ();
+  GST_BUFFER_OFFSET (buffer) = offset;
   _ml_tensors_info_copy_from_ml (&gst_info, _data->info);
 
   for (i = 0; i < _data->num_tensors; i++) {
@@ -1764,6 +1911,17 @@ dont_destroy_data:
   handle_exit (h);
 }
 
+/**
+ * @brief Push a data frame to a src (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
+    ml_pipeline_buf_policy_e policy)
+{
+  return _ml_pipeline_src_input_data_with_offset (h, data, policy,
+      GST_BUFFER_OFFSET_NONE);
+}
+
 /**
  * @brief Internal function to fetch ml_pipeline_src_callbacks_s pointer
  */
@@ -3049,6 +3207,60 @@ done:
   return ret;
 }
 
+/**
+ * @brief Gets the registered tensor_if custom condition of given name. (internal)
+ */
+ml_pipeline_if_h
+_ml_pipeline_if_custom_get (const char *name)
+{
+  pipe_custom_data_s *custom_data;
+
+  if (!STR_IS_VALID (name))
+    return NULL;
+
+  custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_IF, name);
+  if (!custom_data)
+    return NULL;
+
+  ml_pipeline_if_custom_ref (custom_data->handle);
+  return custom_data->handle;
+}
+
+/**
+ * @brief Releases the tensor_if custom condition from _ml_pipeline_if_custom_get(). (internal)
+ */
+void
+_ml_pipeline_if_custom_release (ml_pipeline_if_h if_custom)
+{
+  ml_pipeline_if_custom_unref (if_custom);
+}
+
+/**
+ * @brief Invokes the callback of tensor_if custom condition with given data. (internal)
+ */
+int
+_ml_pipeline_if_custom_invoke (ml_pipeline_if_h if_custom,
+    const ml_tensors_data_h data, const ml_tensors_info_h info, int *result)
+{
+  ml_if_custom_s *c = (ml_if_custom_s *) if_custom;
+  int status;
+
+  if (!c || !c->cb || !result)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, if_custom or result, is NULL. It should be a valid handle from _ml_pipeline_if_custom_get().");
+
+  g_mutex_lock (&c->lock);
+  status = c->cb (data, info, result, c->pdata);
+  g_mutex_unlock (&c->lock);
+
+  if (status != ML_ERROR_NONE)
+    _ml_error_report
+        ("The callback function of custom condition '%s' has returned error: %d.",
+        c->name, status);
+
+  return status;
+}
+
 /**
  * @brief Releases tensor_if custom condition.
  */
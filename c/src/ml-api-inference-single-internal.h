@@ -57,6 +57,13 @@ int _ml_validate_model_file (const char * const *model, const unsigned int num_m
  */
 char* _ml_nnfw_to_str_prop (ml_nnfw_hw_e hw);
 
+/**
+ * @brief Invokes the model with the given input data, without copying the input data. (Internal only)
+ * @details Unlike ml_single_invoke(), the input data is not cloned if the model is invoked in the calling thread (no timeout and no scheduling attributes), so the caller should not release or change the input data until this function returns.
+ *          This is for the internal module which invokes the models with the same input several times (e.g., the cascade of single-shot models).
+ */
+int _ml_single_invoke_no_copy (ml_single_h single, const ml_tensors_data_h input, ml_tensors_data_h *output);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
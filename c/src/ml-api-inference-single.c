@@ -30,6 +30,27 @@
  */
 #define SINGLE_DEFAULT_TIMEOUT 0
 
+/**
+ * @brief The min number of shared worker threads to invoke the model with timeout.
+ */
+#define SINGLE_MIN_INVOKE_WORKERS 4U
+
+/**
+ * @brief The max number of synthetic invokes to warm up the model.
+ */
+#define SINGLE_MAX_WARMUP 100U
+
+/**
+ * @brief The number of sub-buckets for each power of 2 in the latency histogram.
+ */
+#define SINGLE_HIST_SUB_BITS 3U
+#define SINGLE_HIST_SUB_BUCKETS (1U << SINGLE_HIST_SUB_BITS)
+
+/**
+ * @brief The number of buckets in the latency histogram (up to 2^40 microseconds).
+ */
+#define SINGLE_HIST_BUCKETS (40U * SINGLE_HIST_SUB_BUCKETS)
+
 /**
  * @brief Global lock for single shot API
  * @detail This lock ensures that ml_single_close is thread safe. All other API
@@ -40,6 +61,15 @@
  */
 G_LOCK_DEFINE_STATIC (magic);
 
+/**
+ * @brief The worker pool shared by the single handles to invoke the model with timeout.
+ * @note The sub-plugins cannot cancel the invoke, so the timed-out invoke keeps its worker until the model returns.
+ *       The pool is released when the last handle using it is closed.
+ */
+static GThreadPool *single_invoke_pool = NULL;
+static guint single_invoke_pool_users = 0U;
+G_LOCK_DEFINE_STATIC (single_invoke_pool);
+
 /**
  * @brief Get valid handle after magic verification
  * @note handle's mutex (single_h->mutex) is acquired after this
@@ -78,12 +108,21 @@ G_LOCK_DEFINE_STATIC (magic);
 /** concat string from #define */
 #define CONCAT_MACRO_STR(STR1,STR2) STR1 STR2
 
-/** States for invoke thread */
+/**
+ * @brief Internal structure of the input data shared by the handles in ml_single_invoke_multi().
+ */
+typedef struct
+{
+  gint ref;                 /**< reference count, the caller and each request */
+  ml_tensors_data_h data;   /**< the read-only input data */
+} ml_single_shared_input_s;
+
+/** States for invoke request */
 typedef enum
 {
   IDLE = 0,           /**< ready to accept next input */
   RUNNING,            /**< running an input, cannot accept more input */
-  JOIN_REQUESTED      /**< should join the thread, will exit soon */
+  JOIN_REQUESTED      /**< close is requested, will not accept input */
 } thread_state;
 
 /**
@@ -117,6 +156,55 @@ static const char *ml_nnfw_subplugin_name[] = {
   NULL
 };
 
+/**
+ * @brief Enumeration for the steps of the invoke to collect the latency.
+ */
+typedef enum
+{
+  ML_SINGLE_STAT_LOCK = 0,      /**< waiting for the handle mutex */
+  ML_SINGLE_STAT_INPUT,         /**< cloning the input and preparing the output */
+  ML_SINGLE_STAT_INVOKE,        /**< invoking the framework */
+  ML_SINGLE_STAT_OUTPUT,        /**< processing the output */
+  ML_SINGLE_STAT_TOTAL,         /**< whole invoke */
+
+  ML_SINGLE_STAT_MAX
+} ml_single_stat_e;
+
+/**
+ * @brief The names of the steps of the invoke.
+ */
+static const char *ml_single_stat_name[] = {
+  [ML_SINGLE_STAT_LOCK] = "lock",
+  [ML_SINGLE_STAT_INPUT] = "input",
+  [ML_SINGLE_STAT_INVOKE] = "invoke",
+  [ML_SINGLE_STAT_OUTPUT] = "output",
+  [ML_SINGLE_STAT_TOTAL] = "total",
+  NULL
+};
+
+/**
+ * @brief Data structure for the latency histogram (log-linear buckets in microseconds).
+ */
+typedef struct
+{
+  guint64 sum;
+  gint64 max;
+  guint32 buckets[SINGLE_HIST_BUCKETS];
+} ml_single_histogram_s;
+
+/**
+ * @brief Data structure for the timestamps of the invoke request (monotonic time in microseconds).
+ */
+typedef struct
+{
+  gint64 start;                       /**< the caller starts the invoke */
+  gint64 locked;                      /**< the caller gets the handle mutex */
+  gint64 input;                       /**< the input and output are prepared */
+  gint64 invoke_start;                /**< the framework starts the invoke */
+  gint64 invoke_end;                  /**< the framework finishes the invoke */
+  gint64 output;                      /**< the output is processed and returned to the caller */
+} ml_single_invoke_time_s;
+
 /** ML single api data structure for handle */
 typedef struct
 {
@@ -127,13 +215,15 @@ typedef struct
   ml_nnfw_type_e nnfw;                /**< nnfw type for this filter */
   guint magic;                        /**< code to verify valid handle */
 
-  GThread *thread;                    /**< thread for invoking */
+  guint pending;                      /**< the number of requests pushed to the shared worker pool */
+  gboolean pool_user;                 /**< true if the handle refers the shared worker pool */
   GMutex mutex;                       /**< mutex for synchronization */
   GCond cond;                         /**< condition for synchronization */
   ml_tensors_data_h input;            /**< input received from user */
+  ml_single_shared_input_s *shared;   /**< the shared input in ml_single_invoke_multi(), if input is not owned by the handle */
   ml_tensors_data_h output;           /**< output to be sent back to user */
   guint timeout;                      /**< timeout for invoking */
-  thread_state state;                 /**< current state of the thread */
+  thread_state state;                 /**< current state of the invoke request */
   gboolean free_output;               /**< true if output tensors are allocated in single-shot */
   int status;                         /**< status of processing */
   gboolean invoking;                  /**< invoke running flag */
@@ -141,8 +231,121 @@ typedef struct
   ml_tensors_data_h out_tensors;      /**< output tensor wrapper for processing */
 
   GList *destroy_data_list;         /**< data to be freed by filter */
+
+  guint warmup_count;                 /**< the number of synthetic invokes at open time */
+  gint64 warmup_cold_latency;         /**< latency of the first invoke in microseconds */
+  gint64 warmup_warm_latency;         /**< average latency of the other invokes in microseconds */
+
+  gint64 open_time_start;             /**< time to start the framework in microseconds */
+  gint64 open_time_total;             /**< total time to open the model in microseconds */
+
+  guint64 stat_count;                 /**< the number of invokes in the statistics */
+  gboolean warming_up;                /**< the synthetic invokes at open time are not collected in the statistics */
+  gint64 invoke_start;                /**< time the worker started the invoke in microseconds */
+  gint64 invoke_end;                  /**< time the worker finished the invoke in microseconds */
+  ml_single_histogram_s stats[ML_SINGLE_STAT_MAX]; /**< latency histogram of each step of the invoke */
+
+  ml_thread_attr_s thread_attr;       /**< scheduling attributes of the thread invoking the model */
+  guint thread_attr_updated;          /**< increased when the scheduling attributes are changed */
+  guint thread_attr_applied;          /**< the scheduling attributes applied to the dedicated worker */
+  GThreadPool *attr_pool;             /**< the dedicated worker of the handle with the scheduling attributes */
 } ml_single;
 
+/**
+ * @brief Internal function to get the index of histogram bucket.
+ * The values less than the sub-bucket count have own bucket, then each power of 2 is divided into the sub-buckets.
+ */
+static inline guint
+_ml_single_histogram_index (gint64 value)
+{
+  guint64 v = (value > 0) ? (guint64) value : 0ULL;
+  guint msb, index;
+
+  if (v < SINGLE_HIST_SUB_BUCKETS)
+    return (guint) v;
+
+  msb = (guint) g_bit_nth_msf ((gulong) MIN (v, G_MAXULONG), -1);
+  index = (msb - SINGLE_HIST_SUB_BITS + 1) * SINGLE_HIST_SUB_BUCKETS +
+      (guint) ((v >> (msb - SINGLE_HIST_SUB_BITS)) & (SINGLE_HIST_SUB_BUCKETS - 1));
+
+  return MIN (index, SINGLE_HIST_BUCKETS - 1);
+}
+
+/**
+ * @brief Internal function to get the upper bound of histogram bucket.
+ */
+static gint64
+_ml_single_histogram_upper (guint index)
+{
+  guint shift;
+
+  if (index < SINGLE_HIST_SUB_BUCKETS)
+    return (gint64) index;
+
+  shift = index / SINGLE_HIST_SUB_BUCKETS - 1;
+  return (gint64) (((guint64) (SINGLE_HIST_SUB_BUCKETS +
+              index % SINGLE_HIST_SUB_BUCKETS + 1) << shift) - 1);
+}
+
+/**
+ * @brief Internal function to add the latency to the histogram.
+ */
+static inline void
+_ml_single_histogram_add (ml_single_histogram_s * hist, gint64 value)
+{
+  hist->buckets[_ml_single_histogram_index (value)]++;
+  hist->sum += (value > 0) ? (guint64) value : 0ULL;
+  if (value > hist->max)
+    hist->max = value;
+}
+
+/**
+ * @brief Internal function to get the percentile from the histogram.
+ */
+static gint64
+_ml_single_histogram_percentile (const ml_single_histogram_s * hist,
+    guint64 count, guint percent)
+{
+  guint64 target, acc = 0;
+  guint i;
+
+  if (count == 0)
+    return 0;
+
+  target = (count * percent + 99) / 100;
+  for (i = 0; i < SINGLE_HIST_BUCKETS; i++) {
+    acc += hist->buckets[i];
+    if (acc >= target)
+      return MIN (_ml_single_histogram_upper (i), hist->max);
+  }
+
+  return hist->max;
+}
+
+/**
+ * @brief Internal function to add the latency of each step of the successful invoke to the statistics.
+ * @note This function should be called with the lock of the handle.
+ */
+static void
+_ml_single_add_statistics (ml_single * single_h,
+    const ml_single_invoke_time_s * t)
+{
+  if (single_h->warming_up)
+    return;
+
+  single_h->stat_count++;
+  _ml_single_histogram_add (&single_h->stats[ML_SINGLE_STAT_LOCK],
+      t->locked - t->start);
+  _ml_single_histogram_add (&single_h->stats[ML_SINGLE_STAT_INPUT],
+      t->input - t->locked);
+  _ml_single_histogram_add (&single_h->stats[ML_SINGLE_STAT_INVOKE],
+      t->invoke_end - t->invoke_start);
+  _ml_single_histogram_add (&single_h->stats[ML_SINGLE_STAT_OUTPUT],
+      t->output - t->invoke_end);
+  _ml_single_histogram_add (&single_h->stats[ML_SINGLE_STAT_TOTAL],
+      t->output - t->start);
+}
+
 /**
  * @brief Internal function to get the nnfw type.
  */
@@ -470,57 +673,95 @@ __process_output (ml_single * single_h, ml_tensors_data_h output)
 }
 
 /**
- * @brief thread to execute calls to invoke
+ * @brief Internal function to release the input data shared by the handles.
+ */
+static void
+_ml_single_shared_input_unref (ml_single_shared_input_s * shared)
+{
+  if (g_atomic_int_dec_and_test (&shared->ref)) {
+    ml_tensors_data_destroy (shared->data);
+    g_free (shared);
+  }
+}
+
+/**
+ * @brief Internal function to release the input data of the request not started yet.
+ * @note This function should be called with the lock of the handle.
+ */
+static void
+_ml_single_release_input (ml_single * single_h)
+{
+  if (single_h->shared)
+    _ml_single_shared_input_unref (single_h->shared);
+  else if (single_h->input)
+    ml_tensors_data_destroy (single_h->input);
+
+  single_h->input = NULL;
+  single_h->shared = NULL;
+}
+
+/**
+ * @brief Worker function to execute the invoke request with timeout.
  *
- * @details The thread behavior is detailed as below:
- *          - Starting with IDLE state, the thread waits for an input or change
- *          in state externally.
- *          - If state is not RUNNING, exit this thread, else process the
- *          request.
+ * @details The worker behavior is detailed as below:
+ *          - If the request is cancelled (timed out before the worker starts it, or close is requested), do nothing.
  *          - Process input, call invoke, process output. Any error in this
  *          state sets the status to be used by ml_single_invoke().
- *          - State is set back to IDLE and thread moves back to start.
+ *          - State is set back to IDLE and the caller is notified.
  *
  *          State changes performed by this function when:
  *          RUNNING -> IDLE - processing is finished.
- *          JOIN_REQUESTED -> IDLE - close is requested.
  *
- * @note Error while processing an input is provided back to requesting
- *       function, and further processing of invoke_thread is not affected.
+ * @note The handle may have more pushed requests than the running one (the request cancelled by timeout),
+ *       so the worker takes the input of the handle and the other worker finds nothing to process.
+ *       The handle with the scheduling attributes has the dedicated worker (user_data is not NULL), the attributes are applied only to this worker.
  */
-static void *
-invoke_thread (void *arg)
+static void
+invoke_worker (gpointer data, gpointer user_data)
 {
-  ml_single *single_h;
+  ml_single *single_h = (ml_single *) data;
   ml_tensors_data_h input, output;
-  gboolean alloc_output = FALSE;
-
-  single_h = (ml_single *) arg;
+  ml_single_shared_input_s *shared;
+  gboolean alloc_output;
+  gint64 invoke_start, invoke_end;
+  int status = ML_ERROR_NONE;
 
   g_mutex_lock (&single_h->mutex);
 
-  while (single_h->state <= RUNNING) {
-    int status = ML_ERROR_NONE;
-
-    /** wait for data */
-    while (single_h->state != RUNNING) {
-      g_cond_wait (&single_h->cond, &single_h->mutex);
-      if (single_h->state == JOIN_REQUESTED)
-        goto exit;
-    }
-
+  if (single_h->state == RUNNING && single_h->input) {
     input = single_h->input;
     output = single_h->output;
+    shared = single_h->shared;
     /* Set null to prevent double-free. */
     single_h->input = single_h->output = NULL;
+    single_h->shared = NULL;
+
+    /* The dedicated worker keeps the attributes, apply it again only if changed. */
+    if (user_data &&
+        single_h->thread_attr_applied != single_h->thread_attr_updated) {
+      status = _ml_thread_attr_apply (&single_h->thread_attr, 0, NULL);
+      if (status == ML_ERROR_NONE)
+        single_h->thread_attr_applied = single_h->thread_attr_updated;
+    }
 
     single_h->invoking = TRUE;
     alloc_output = single_h->free_output;
     g_mutex_unlock (&single_h->mutex);
-    status = __invoke (single_h, input, output, alloc_output);
+    invoke_start = g_get_monotonic_time ();
+    if (status == ML_ERROR_NONE) {
+      status = __invoke (single_h, input, output, alloc_output);
+    } else {
+      _ml_error_report
+          ("Failed to apply the scheduling attributes of the single handle, the request is not invoked.");
+    }
+    invoke_end = g_get_monotonic_time ();
+
     g_mutex_lock (&single_h->mutex);
     /* Clear input data after invoke is done. */
-    ml_tensors_data_destroy (input);
+    if (shared)
+      _ml_single_shared_input_unref (shared);
+    else
+      ml_tensors_data_destroy (input);
     single_h->invoking = FALSE;
 
     if (status != ML_ERROR_NONE || single_h->state == JOIN_REQUESTED) {
@@ -529,41 +770,124 @@ invoke_thread (void *arg)
             g_list_remove (single_h->destroy_data_list, output);
         ml_tensors_data_destroy (output);
       }
-
-      if (single_h->state == JOIN_REQUESTED)
-        goto exit;
-      goto wait_for_next;
-    }
-
-    if (alloc_output)
+    } else if (alloc_output) {
       __process_output (single_h, output);
+    }
 
-    /** loop over to wait for the next element */
-  wait_for_next:
     single_h->status = status;
+    single_h->invoke_start = invoke_start;
+    single_h->invoke_end = invoke_end;
     if (single_h->state == RUNNING)
       single_h->state = IDLE;
-    g_cond_broadcast (&single_h->cond);
   }
 
-exit:
-  /* Do not set IDLE if JOIN_REQUESTED */
-  if (single_h->state == JOIN_REQUESTED) {
-    /* Release input and output data */
-    if (single_h->input)
-      ml_tensors_data_destroy (single_h->input);
+  single_h->pending--;
+  g_cond_broadcast (&single_h->cond);
+  g_mutex_unlock (&single_h->mutex);
+}
 
-    if (alloc_output && single_h->output) {
-      single_h->destroy_data_list =
-          g_list_remove (single_h->destroy_data_list, single_h->output);
-      ml_tensors_data_destroy (single_h->output);
+/**
+ * @brief Internal function to push the invoke request to the shared worker pool.
+ * The handle with the scheduling attributes pushes the request to its dedicated worker, so that the attributes do not remain in the shared worker.
+ * @note This function should be called with the lock of the handle.
+ */
+static int
+_ml_single_push_request (ml_single * single_h)
+{
+  g_autoptr (GError) error = NULL;
+  guint max_workers;
+
+  if (_ml_thread_attr_is_set (&single_h->thread_attr)) {
+    if (!single_h->attr_pool) {
+      single_h->attr_pool = g_thread_pool_new (invoke_worker,
+          GINT_TO_POINTER (TRUE), 1, TRUE, &error);
     }
 
-    single_h->input = single_h->output = NULL;
-  } else if (single_h->state == RUNNING)
-    single_h->state = IDLE;
-  g_mutex_unlock (&single_h->mutex);
-  return NULL;
+    if (single_h->attr_pool) {
+      single_h->pending++;
+      if (!g_thread_pool_push (single_h->attr_pool, single_h, &error))
+        single_h->pending--;
+    }
+
+    if (error) {
+      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+          "Failed to push the invoke request to the dedicated worker: %s.",
+          error->message);
+    }
+
+    return ML_ERROR_NONE;
+  }
+
+  G_LOCK (single_invoke_pool);
+  if (!single_invoke_pool) {
+    max_workers = MAX (SINGLE_MIN_INVOKE_WORKERS, g_get_num_processors ());
+    single_invoke_pool = g_thread_pool_new (invoke_worker, NULL,
+        (gint) max_workers, FALSE, &error);
+  }
+
+  if (single_invoke_pool) {
+    if (!single_h->pool_user) {
+      single_h->pool_user = TRUE;
+      single_invoke_pool_users++;
+    }
+
+    single_h->pending++;
+    if (!g_thread_pool_push (single_invoke_pool, single_h, &error))
+      single_h->pending--;
+  }
+  G_UNLOCK (single_invoke_pool);
+
+  if (error) {
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to push the invoke request to the worker pool: %s.",
+        error->message);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to wait for the request in the worker pool until given end time (0 to wait until done).
+ * @details If the request is not started until the end time, the request is cancelled and the handle accepts next input.
+ * @note This function should be called with the lock of the handle.
+ */
+static int
+_ml_single_wait_request (ml_single * single_h, ml_tensors_data_h output,
+    gboolean need_alloc, gint64 end_time)
+{
+  int status;
+
+  while (single_h->state == RUNNING) {
+    if (end_time == 0)
+      g_cond_wait (&single_h->cond, &single_h->mutex);
+    else if (!g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time))
+      break;
+  }
+
+  if (single_h->state == IDLE) {
+    status = single_h->status;
+  } else if (single_h->state == JOIN_REQUESTED) {
+    _ml_error_report
+        ("The handle (single_h single) is closed while waiting for the invoke.");
+    status = ML_ERROR_STREAMS_PIPE;
+  } else {
+    _ml_logw ("Wait for invoke has timed out");
+    status = ML_ERROR_TIMED_OUT;
+
+    if (single_h->input) {
+      /* The worker has not started the request, cancel it and the handle accepts next input. */
+      _ml_single_release_input (single_h);
+      if (need_alloc)
+        ml_tensors_data_destroy (output);
+      single_h->output = NULL;
+      single_h->state = IDLE;
+    } else if (need_alloc) {
+      /** This is set to notify the worker to release the output if timed out */
+      set_destroy_notify (single_h, output, TRUE);
+    }
+  }
+
+  return status;
 }
 
 /**
@@ -823,7 +1147,6 @@ static ml_single *
 ml_single_create_handle (ml_nnfw_type_e nnfw)
 {
   ml_single *single_h;
-  GError *error;
   gboolean created = FALSE;
 
   single_h = g_new0 (ml_single, 1);
@@ -843,7 +1166,7 @@ ml_single_create_handle (ml_nnfw_type_e nnfw)
   single_h->timeout = SINGLE_DEFAULT_TIMEOUT;
   single_h->nnfw = nnfw;
   single_h->state = IDLE;
-  single_h->thread = NULL;
+  single_h->pending = 0;
   single_h->input = NULL;
   single_h->output = NULL;
   single_h->destroy_data_list = NULL;
@@ -861,16 +1184,6 @@ ml_single_create_handle (ml_nnfw_type_e nnfw)
     goto done;
   }
 
-  single_h->thread =
-      g_thread_try_new (NULL, invoke_thread, (gpointer) single_h, &error);
-  if (single_h->thread == NULL) {
-    _ml_error_report
-        ("Failed to create the invoke thread of single API, g_thread_try_new has reported an error: %s.",
-        error->message);
-    g_clear_error (&error);
-    goto done;
-  }
-
   created = TRUE;
 
 done:
@@ -947,9 +1260,12 @@ ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
   gchar **list_models;
   guint i, num_models;
   char *hw_name;
+  gint64 open_start, start;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
+  open_start = g_get_monotonic_time ();
+
   /* Validate the params */
   _ml_error_report_return_continue_iferr
       (_ml_single_open_custom_validate_arguments (single, info),
@@ -1070,6 +1386,7 @@ ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
   hw_name = _ml_nnfw_to_str_prop (hw);
   g_object_set (filter_obj, "framework", fw_name, "accelerator", hw_name,
       "model", info->models, NULL);
+
   g_free (hw_name);
 
   if (info->custom_option) {
@@ -1077,6 +1394,7 @@ ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
   }
 
   /* 4. Start the nnfw to get inout configurations if needed */
+  start = g_get_monotonic_time ();
   if (!single_h->klass->start (single_h->filter)) {
     _ml_error_report
         ("Failed to start NNFW, '%s', to get inout configurations. Subplugin class method has failed to start.",
@@ -1127,9 +1445,16 @@ ml_single_open_custom (ml_single_h * single, ml_single_preset * info)
     goto error;
   }
 
+  single_h->open_time_start = g_get_monotonic_time () - start;
+
   /* Setup input and output memory buffers for invoke */
   __setup_in_out_tensors (single_h);
 
+  single_h->open_time_total = g_get_monotonic_time () - open_start;
+  _ml_logd ("Opened the model in %" G_GINT64_FORMAT " us (start %"
+      G_GINT64_FORMAT " us).", single_h->open_time_total,
+      single_h->open_time_start);
+
   *single = single_h;
   return ML_ERROR_NONE;
 
@@ -1170,6 +1495,71 @@ ml_single_open_full (ml_single_h * single, const char *model,
   return ml_single_open_custom (single, &info);
 }
 
+/**
+ * @brief Internal function to run the synthetic invokes with the input information of the model.
+ * The latency of the first invoke (cold) and the average of the others (warm) are kept in the handle.
+ */
+static void
+_ml_single_warmup (ml_single_h single, guint count)
+{
+  ml_single *single_h;
+  ml_tensors_info_h in_info = NULL;
+  ml_tensors_data_h input = NULL;
+  ml_tensors_data_h output = NULL;
+  gint64 start, elapsed, cold = 0, warm = 0;
+  guint i;
+  int status;
+
+  status = ml_single_get_input_info (single, &in_info);
+  if (status == ML_ERROR_NONE)
+    status = ml_tensors_data_create (in_info, &input);
+
+  /* The handle is just opened and valid, the synthetic invokes are excluded from the statistics. */
+  single_h = (ml_single *) single;
+  g_mutex_lock (&single_h->mutex);
+  single_h->warming_up = TRUE;
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  for (i = 0; i < count && status == ML_ERROR_NONE; i++) {
+    start = g_get_monotonic_time ();
+    status = ml_single_invoke (single, input, &output);
+    elapsed = g_get_monotonic_time () - start;
+
+    if (status != ML_ERROR_NONE)
+      break;
+
+    ml_tensors_data_destroy (output);
+    output = NULL;
+
+    if (i == 0)
+      cold = elapsed;
+    else
+      warm += elapsed;
+  }
+
+  if (status != ML_ERROR_NONE)
+    _ml_logw ("Failed to warm up the model (%d), the handle is opened anyway.",
+        status);
+  else
+    _ml_logd ("Warmed up the model, cold latency %" G_GINT64_FORMAT
+        " us, warm latency %" G_GINT64_FORMAT " us.", cold,
+        (i > 1) ? warm / (i - 1) : cold);
+
+  g_mutex_lock (&single_h->mutex);
+  single_h->warming_up = FALSE;
+  if (i > 0) {
+    single_h->warmup_count = i;
+    single_h->warmup_cold_latency = cold;
+    single_h->warmup_warm_latency = (i > 1) ? warm / (i - 1) : cold;
+  }
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  if (input)
+    ml_tensors_data_destroy (input);
+  if (in_info)
+    ml_tensors_info_destroy (in_info);
+}
+
 /**
  * @brief Open new single handle with given option.
  */
@@ -1178,6 +1568,9 @@ ml_single_open_with_option (ml_single_h * single, const ml_option_h option)
 {
   void *value;
   ml_single_preset info = { 0, };
+  ml_thread_attr_s thread_attr = { 0, };
+  guint64 warmup = 0;
+  int status;
 
   check_feature_state (ML_FEATURE_INFERENCE);
 
@@ -1205,8 +1598,37 @@ ml_single_open_with_option (ml_single_h * single, const ml_option_h option)
   if (ML_ERROR_NONE == ml_option_get (option, "framework_name", &value) ||
       ML_ERROR_NONE == ml_option_get (option, "framework", &value))
     info.fw_name = (gchar *) value;
+  if (ML_ERROR_NONE == ml_option_get (option, "warmup", &value)) {
+    if (!g_ascii_string_to_unsigned ((gchar *) value, 10, 0,
+            SINGLE_MAX_WARMUP, &warmup, NULL)) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'warmup' (%s) is invalid. It should be a number less than or equal to %u.",
+          (gchar *) value, SINGLE_MAX_WARMUP);
+    }
+  }
 
-  return ml_single_open_custom (single, &info);
+  status = _ml_thread_attr_set_from_option (&thread_attr, option);
+  if (status != ML_ERROR_NONE) {
+    _ml_thread_attr_clear (&thread_attr);
+    _ml_error_report_return (status,
+        "Failed to parse the scheduling attributes of the thread in the option.");
+  }
+
+  status = ml_single_open_custom (single, &info);
+
+  if (status == ML_ERROR_NONE && _ml_thread_attr_is_set (&thread_attr)) {
+    ml_single *single_h = (ml_single *) (*single);
+
+    _ml_thread_attr_copy (&single_h->thread_attr, &thread_attr);
+    single_h->thread_attr_updated++;
+  }
+  _ml_thread_attr_clear (&thread_attr);
+
+  /* Run synthetic invokes before returning the handle, to avoid the latency spike of the first requests. */
+  if (status == ML_ERROR_NONE && warmup > 0)
+    _ml_single_warmup (*single, (guint) warmup);
+
+  return status;
 }
 
 /**
@@ -1215,8 +1637,8 @@ ml_single_open_with_option (ml_single_h * single, const ml_option_h option)
  * @details State changes performed by this function:
  *          ANY STATE -> JOIN REQUESTED - on receiving a request to close
  *
- *          Once requested to close, invoke_thread() will exit after processing
- *          the current input (if any).
+ *          Once requested to close, the request not started yet is cancelled,
+ *          and close waits for the worker processing the current input (if any).
  */
 int
 ml_single_close (ml_single_h single)
@@ -1233,7 +1655,24 @@ ml_single_close (ml_single_h single)
   ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 1);
 
   single_h->state = JOIN_REQUESTED;
+
+  /* Cancel the request not started yet, and wait for the workers referring this handle. */
+  if (single_h->input) {
+    _ml_single_release_input (single_h);
+
+    if (single_h->free_output && single_h->output) {
+      single_h->destroy_data_list =
+          g_list_remove (single_h->destroy_data_list, single_h->output);
+      ml_tensors_data_destroy (single_h->output);
+    }
+
+    single_h->input = single_h->output = NULL;
+  }
+
   g_cond_broadcast (&single_h->cond);
+  while (single_h->pending > 0)
+    g_cond_wait (&single_h->cond, &single_h->mutex);
+
   invoking = single_h->invoking;
   ML_SINGLE_HANDLE_UNLOCK (single_h);
 
@@ -1250,9 +1689,6 @@ ml_single_close (ml_single_h single)
      */
   }
 
-  if (single_h->thread != NULL)
-    g_thread_join (single_h->thread);
-
   /** locking ensures correctness with parallel calls on close */
   if (single_h->filter) {
     g_list_foreach (single_h->destroy_data_list, __destroy_notify, single_h);
@@ -1276,9 +1712,29 @@ ml_single_close (ml_single_h single)
   ml_tensors_data_destroy (single_h->in_tensors);
   ml_tensors_data_destroy (single_h->out_tensors);
 
+  /* No pending request, the dedicated worker exits. */
+  if (single_h->attr_pool)
+    g_thread_pool_free (single_h->attr_pool, TRUE, TRUE);
+
+  /* Release the shared worker pool if this is the last handle using it. */
+  if (single_h->pool_user) {
+    GThreadPool *pool = NULL;
+
+    G_LOCK (single_invoke_pool);
+    if (--single_invoke_pool_users == 0U) {
+      pool = single_invoke_pool;
+      single_invoke_pool = NULL;
+    }
+    G_UNLOCK (single_invoke_pool);
+
+    if (pool)
+      g_thread_pool_free (pool, TRUE, TRUE);
+  }
+
   g_cond_clear (&single_h->cond);
   g_mutex_clear (&single_h->mutex);
 
+  _ml_thread_attr_clear (&single_h->thread_attr);
   g_free (single_h);
   return ML_ERROR_NONE;
 }
@@ -1337,20 +1793,22 @@ _ml_single_invoke_validate_data (ml_single_h single,
  *          IDLE -> RUNNING - on receiving a valid request
  *
  *          Invoke returns error if the current state is not IDLE.
- *          If IDLE, then invoke is requested to the thread.
+ *          If IDLE and timeout is set, then invoke is requested to the shared worker pool.
  *          Invoke waits for the processing to be complete, and returns back
- *          the result once notified by the processing thread.
+ *          the result once notified by the worker.
  *
  * @note IDLE is the valid thread state before and after this function call.
  */
 static int
 _ml_single_invoke_internal (ml_single_h single,
     const ml_tensors_data_h input, ml_tensors_data_h * output,
-    const gboolean need_alloc)
+    const gboolean need_alloc, const gboolean need_copy)
 {
   ml_single *single_h;
   ml_tensors_data_h _in, _out;
+  gboolean in_worker;
   gint64 end_time;
+  ml_single_invoke_time_s t = { 0, };
   int status = ML_ERROR_NONE;
 
   check_feature_state (ML_FEATURE_INFERENCE);
@@ -1367,7 +1825,9 @@ _ml_single_invoke_internal (ml_single_h single,
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "(internal function) The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
 
+  t.start = g_get_monotonic_time ();
   ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  t.locked = g_get_monotonic_time ();
 
   if (G_UNLIKELY (!single_h->filter)) {
     _ml_error_report
@@ -1422,32 +1882,51 @@ _ml_single_invoke_internal (ml_single_h single,
   /**
    * Clone input data here to prevent use-after-free case.
    * We should release single_h->input after calling __invoke() function.
+   * The worker may run after the caller returns with timeout, so the input is always cloned for the worker.
    */
-  status = ml_tensors_data_clone (input, &_in);
-  if (status != ML_ERROR_NONE)
-    goto exit;
+  in_worker = (single_h->timeout > 0 ||
+      _ml_thread_attr_is_set (&single_h->thread_attr));
+  if (need_copy || in_worker) {
+    status = ml_tensors_data_clone (input, &_in);
+    if (status != ML_ERROR_NONE) {
+      if (need_alloc)
+        ml_tensors_data_destroy (_out);
+      goto exit;
+    }
+  } else {
+    _in = input;
+  }
+
+  t.input = g_get_monotonic_time ();
 
   single_h->state = RUNNING;
   single_h->free_output = need_alloc;
   single_h->input = _in;
   single_h->output = _out;
 
-  if (single_h->timeout > 0) {
-    /* Wake up "invoke_thread" */
-    g_cond_broadcast (&single_h->cond);
-
-    /* set timeout */
-    end_time = g_get_monotonic_time () +
-        single_h->timeout * G_TIME_SPAN_MILLISECOND;
-
-    if (g_cond_wait_until (&single_h->cond, &single_h->mutex, end_time)) {
-      status = single_h->status;
-    } else {
-      _ml_logw ("Wait for invoke has timed out");
-      status = ML_ERROR_TIMED_OUT;
-      /** This is set to notify invoke_thread to not process if timed out */
+  /* The scheduling attributes are applied in the worker, do not change the caller thread. */
+  if (in_worker) {
+    status = _ml_single_push_request (single_h);
+    if (status != ML_ERROR_NONE) {
+      ml_tensors_data_destroy (_in);
       if (need_alloc)
-        set_destroy_notify (single_h, _out, TRUE);
+        ml_tensors_data_destroy (_out);
+      single_h->state = IDLE;
+      goto exit;
+    }
+
+    /* set timeout, wait until done if only the scheduling attributes are set */
+    end_time = 0;
+    if (single_h->timeout > 0)
+      end_time = g_get_monotonic_time () +
+          single_h->timeout * G_TIME_SPAN_MILLISECOND;
+
+    status = _ml_single_wait_request (single_h, _out, need_alloc, end_time);
+    if (status == ML_ERROR_NONE) {
+      /* The worker gives the time of the invoke, the output step includes the time to wake up the caller. */
+      t.invoke_start = single_h->invoke_start;
+      t.invoke_end = single_h->invoke_end;
+      t.output = g_get_monotonic_time ();
     }
   } else {
     /**
@@ -1459,8 +1938,11 @@ _ml_single_invoke_internal (ml_single_h single,
      * having yet another mutex for __invoke.
      */
     single_h->invoking = TRUE;
+    t.invoke_start = g_get_monotonic_time ();
     status = __invoke (single_h, _in, _out, need_alloc);
-    ml_tensors_data_destroy (_in);
+    t.invoke_end = g_get_monotonic_time ();
+    if (need_copy)
+      ml_tensors_data_destroy (_in);
     single_h->invoking = FALSE;
     single_h->state = IDLE;
 
@@ -1472,12 +1954,17 @@ _ml_single_invoke_internal (ml_single_h single,
 
     if (need_alloc)
       __process_output (single_h, _out);
+    t.output = g_get_monotonic_time ();
   }
 
 exit:
   if (status == ML_ERROR_NONE) {
     if (need_alloc)
       *output = _out;
+
+    /* The latency is collected in the handle lock, for the successful invoke only. */
+    if (t.output > 0)
+      _ml_single_add_statistics (single_h, &t);
   }
 
   single_h->input = single_h->output = NULL;
@@ -1492,7 +1979,209 @@ int
 ml_single_invoke (ml_single_h single,
     const ml_tensors_data_h input, ml_tensors_data_h * output)
 {
-  return _ml_single_invoke_internal (single, input, output, TRUE);
+  return _ml_single_invoke_internal (single, input, output, TRUE, TRUE);
+}
+
+/**
+ * @brief Invokes the model with the given input data, without copying the input data. (Internal only)
+ */
+int
+_ml_single_invoke_no_copy (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h * output)
+{
+  return _ml_single_invoke_internal (single, input, output, TRUE, FALSE);
+}
+
+/**
+ * @brief Internal function to push the request with shared input to the worker pool.
+ */
+static int
+_ml_single_invoke_multi_submit (ml_single_h single,
+    ml_single_shared_input_s * shared, ml_tensors_data_h * output,
+    ml_single_invoke_time_s * t)
+{
+  ml_single *single_h;
+  ml_tensors_data_h _out = NULL;
+  int status = ML_ERROR_NONE;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  t->locked = g_get_monotonic_time ();
+
+  if (G_UNLIKELY (!single_h->filter)) {
+    _ml_error_report
+        ("The tensor_filter element of this single handle (single_h) is not valid.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = _ml_single_invoke_validate_data (single, shared->data, TRUE);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("The input data for the inference is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
+        status);
+    goto done;
+  }
+
+  if (single_h->state != IDLE) {
+    _ml_error_report
+        ("The handle (single_h single) is busy or being closed. Please retry invoking again later when the handle becomes idle.");
+    status = (single_h->state == JOIN_REQUESTED) ?
+        ML_ERROR_STREAMS_PIPE : ML_ERROR_TRY_AGAIN;
+    goto done;
+  }
+
+  status = _ml_tensors_data_clone_no_alloc (single_h->out_tensors, &_out);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  g_atomic_int_inc (&shared->ref);
+  t->input = g_get_monotonic_time ();
+
+  single_h->state = RUNNING;
+  single_h->free_output = TRUE;
+  single_h->input = shared->data;
+  single_h->shared = shared;
+  single_h->output = _out;
+
+  status = _ml_single_push_request (single_h);
+  if (status != ML_ERROR_NONE) {
+    _ml_single_release_input (single_h);
+    ml_tensors_data_destroy (_out);
+    single_h->output = NULL;
+    single_h->state = IDLE;
+    goto done;
+  }
+
+  *output = _out;
+
+done:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Internal function to wait for the request with shared input.
+ */
+static int
+_ml_single_invoke_multi_wait (ml_single_h single, ml_tensors_data_h _out,
+    gint64 end_time, ml_tensors_data_h * output, ml_single_invoke_time_s * t)
+{
+  ml_single *single_h;
+  int status;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  status = _ml_single_wait_request (single_h, _out, TRUE, end_time);
+  if (status == ML_ERROR_NONE) {
+    *output = _out;
+
+    t->invoke_start = single_h->invoke_start;
+    t->invoke_end = single_h->invoke_end;
+    t->output = g_get_monotonic_time ();
+    _ml_single_add_statistics (single_h, t);
+  }
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
+/**
+ * @brief Invokes the models with the same input data concurrently (Tizen internal, see nnstreamer-tizen-internal.h)
+ */
+int
+ml_single_invoke_multi (ml_single_h * single, const unsigned int count,
+    const ml_tensors_data_h input, ml_tensors_data_h * output,
+    const unsigned int timeout)
+{
+  ml_single_shared_input_s *shared;
+  g_autofree ml_tensors_data_h *_out = NULL;
+  g_autofree ml_single_invoke_time_s *t = NULL;
+  gint64 start_time, end_time = 0;
+  guint i, j, submitted;
+  int status, ret;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single || count == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h *), is NULL or count is 0. It should be a valid array of ml_single_h instances.");
+
+  if (!input)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, input (ml_tensors_data_h), is NULL. It should be a valid instance of ml_tensors_data_h.");
+
+  if (!output)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid array of ml_tensors_data_h to store the inference results.");
+
+  for (i = 0; i < count; i++) {
+    if (!single[i])
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, single[%u] (ml_single_h), is NULL.", i);
+
+    for (j = 0; j < i; j++) {
+      if (single[i] == single[j])
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The parameter, single[%u] (ml_single_h), is duplicated. A handle can process one request at a time.",
+            i);
+    }
+
+    output[i] = NULL;
+  }
+
+  start_time = g_get_monotonic_time ();
+
+  /**
+   * Clone the input data once, the requests share the read-only input.
+   * The requests may run after timeout, so the shared input is released by the last one.
+   */
+  shared = g_new0 (ml_single_shared_input_s, 1);
+  shared->ref = 1;
+
+  status = ml_tensors_data_clone (input, &shared->data);
+  if (status != ML_ERROR_NONE) {
+    g_free (shared);
+    _ml_error_report_return (status,
+        "Failed to create the input data shared by the handles.");
+  }
+
+  _out = g_new0 (ml_tensors_data_h, count);
+  t = g_new0 (ml_single_invoke_time_s, count);
+
+  if (timeout > 0)
+    end_time = g_get_monotonic_time () + timeout * G_TIME_SPAN_MILLISECOND;
+
+  for (submitted = 0; submitted < count; submitted++) {
+    t[submitted].start = start_time;
+    status = _ml_single_invoke_multi_submit (single[submitted], shared,
+        &_out[submitted], &t[submitted]);
+    if (status != ML_ERROR_NONE)
+      break;
+  }
+
+  /* Wait for all submitted requests, even if some request has failed. */
+  for (i = 0; i < submitted; i++) {
+    ret = _ml_single_invoke_multi_wait (single[i], _out[i], end_time,
+        &output[i], &t[i]);
+    if (ret != ML_ERROR_NONE && status == ML_ERROR_NONE)
+      status = ret;
+  }
+
+  _ml_single_shared_input_unref (shared);
+
+  if (status != ML_ERROR_NONE) {
+    for (i = 0; i < count; i++) {
+      if (output[i]) {
+        ml_tensors_data_destroy (output[i]);
+        output[i] = NULL;
+      }
+    }
+
+    _ml_error_report_return_continue (status,
+        "Failed to invoke the models with the same input data.");
+  }
+
+  return ML_ERROR_NONE;
 }
 
 /**
@@ -1502,7 +2191,7 @@ int
 ml_single_invoke_fast (ml_single_h single,
     const ml_tensors_data_h input, ml_tensors_data_h output)
 {
-  return _ml_single_invoke_internal (single, input, &output, FALSE);
+  return _ml_single_invoke_internal (single, input, &output, FALSE, TRUE);
 }
 
 /**
@@ -1744,6 +2433,14 @@ ml_single_set_property (ml_single_h single, const char *name, const char *value)
           value);
       status = ML_ERROR_INVALID_PARAMETER;
     }
+  } else if (g_str_equal (name, "cpu-affinity") || g_str_equal (name, "nice")
+      || g_str_equal (name, "sched-policy")
+      || g_str_equal (name, "sched-priority")
+      || g_str_equal (name, "thread-name")) {
+    /* scheduling attributes of the thread, applied from next invoke */
+    status = _ml_thread_attr_set (&single_h->thread_attr, name, value);
+    if (status == ML_ERROR_NONE)
+      single_h->thread_attr_updated++;
   } else if (g_str_equal (name, "input") || g_str_equal (name, "inputtype")
       || g_str_equal (name, "inputname") || g_str_equal (name, "output")
       || g_str_equal (name, "outputtype") || g_str_equal (name, "outputname")) {
@@ -1830,9 +2527,26 @@ ml_single_get_property (ml_single_h single, const char *name, char **value)
     /* boolean */
     g_object_get (G_OBJECT (single_h->filter), name, &bool_value, NULL);
     *value = (bool_value) ? g_strdup ("true") : g_strdup ("false");
+  } else if (g_str_equal (name, "open-time-start")) {
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT, single_h->open_time_start);
+  } else if (g_str_equal (name, "open-time-total")) {
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT, single_h->open_time_total);
+  } else if (g_str_equal (name, "cpu-affinity") || g_str_equal (name, "nice")
+      || g_str_equal (name, "sched-policy")
+      || g_str_equal (name, "sched-priority")
+      || g_str_equal (name, "thread-name")) {
+    status = _ml_thread_attr_get (&single_h->thread_attr, name, value);
+  } else if (g_str_equal (name, "warmup-count")) {
+    *value = g_strdup_printf ("%u", single_h->warmup_count);
+  } else if (g_str_equal (name, "warmup-cold-latency")) {
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT,
+        single_h->warmup_cold_latency);
+  } else if (g_str_equal (name, "warmup-warm-latency")) {
+    *value = g_strdup_printf ("%" G_GINT64_FORMAT,
+        single_h->warmup_warm_latency);
   } else {
     _ml_error_report
-        ("The property key, '%s', is not available for get_property and not recognized by the API. It should be one of {input, inputtype, inputname, inputlayout, output, outputtype, outputname, outputlayout, accelerator, custom, is-updatable}.",
+        ("The property key, '%s', is not available for get_property and not recognized by the API. It should be one of {input, inputtype, inputname, inputlayout, output, outputtype, outputname, outputlayout, accelerator, custom, is-updatable, open-time-start, open-time-total, warmup-count, warmup-cold-latency, warmup-warm-latency, cpu-affinity, nice, sched-policy, sched-priority, thread-name}.",
         name);
     status = ML_ERROR_NOT_SUPPORTED;
   }
@@ -2035,3 +2749,96 @@ done:
   g_strfreev (file_ext);
   return status;
 }
+
+/**
+ * @brief Internal function to set the latency of the step in the information handle.
+ */
+static void
+_ml_single_set_statistics (ml_information_h info, const gchar * step,
+    const gchar * name, gint64 value)
+{
+  g_autofree gchar *key = g_strdup_printf ("%s_%s", step, name);
+
+  _ml_information_set (info, key, g_strdup_printf ("%" G_GINT64_FORMAT,
+          value), g_free);
+}
+
+/**
+ * @brief Gets the invoke latency statistics of the single-shot handle.
+ */
+int
+ml_single_get_statistics (ml_single_h single, ml_information_h * info)
+{
+  ml_single *single_h;
+  ml_information_h _info = NULL;
+  ml_single_histogram_s *hist;
+  guint64 count;
+  guint i;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info (ml_information_h *), is NULL. It should be a valid pointer to get the statistics.");
+
+  *info = NULL;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  status = _ml_information_create (&_info);
+  if (status != ML_ERROR_NONE) {
+    ML_SINGLE_HANDLE_UNLOCK (single_h);
+    _ml_error_report_return (status,
+        "Failed to create the information handle for the statistics.");
+  }
+
+  count = single_h->stat_count;
+  _ml_information_set (_info, "count",
+      g_strdup_printf ("%" G_GUINT64_FORMAT, count), g_free);
+
+  for (i = 0; i < ML_SINGLE_STAT_MAX; i++) {
+    hist = &single_h->stats[i];
+
+    _ml_single_set_statistics (_info, ml_single_stat_name[i], "p50",
+        _ml_single_histogram_percentile (hist, count, 50));
+    _ml_single_set_statistics (_info, ml_single_stat_name[i], "p90",
+        _ml_single_histogram_percentile (hist, count, 90));
+    _ml_single_set_statistics (_info, ml_single_stat_name[i], "p99",
+        _ml_single_histogram_percentile (hist, count, 99));
+    _ml_single_set_statistics (_info, ml_single_stat_name[i], "max",
+        hist->max);
+    _ml_single_set_statistics (_info, ml_single_stat_name[i], "avg",
+        (count > 0) ? (gint64) (hist->sum / count) : 0);
+  }
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  *info = _info;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Resets the invoke latency statistics of the single-shot handle.
+ */
+int
+ml_single_reset_statistics (ml_single_h single)
+{
+  ml_single *single_h;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+  single_h->stat_count = 0;
+  memset (single_h->stats, 0, sizeof (single_h->stats));
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  return ML_ERROR_NONE;
+}
@@ -344,6 +344,76 @@ int _ml_information_list_create (ml_information_list_h *list);
  */
 int _ml_information_list_add (ml_information_list_h list, ml_information_h info);
 
+/**
+ * @brief Enumeration for the scheduling policy of the thread.
+ */
+typedef enum {
+  ML_THREAD_POLICY_DEFAULT = 0, /**< The time-sharing policy (SCHED_OTHER). */
+  ML_THREAD_POLICY_FIFO,        /**< The real-time first-in first-out policy (SCHED_FIFO). */
+  ML_THREAD_POLICY_RR,          /**< The real-time round-robin policy (SCHED_RR). */
+} ml_thread_policy_e;
+
+/**
+ * @brief Data structure for the scheduling attributes of the thread running the model.
+ * @details The keys to set the attributes are cpu_affinity (list of CPUs, e.g., "0-3,6"), nice, sched_policy (other, fifo or rr), sched_priority (1 ~ 99 for real-time policy) and thread_name.
+ */
+typedef struct {
+  gchar *cpu_affinity;        /**< The list of CPUs, NULL to keep the CPU mask. */
+  gboolean has_nice;          /**< TRUE if the nice value is set. */
+  gint nice;                  /**< The nice value (-20 ~ 19). */
+  gboolean has_policy;        /**< TRUE if the scheduling policy is set. */
+  ml_thread_policy_e policy;  /**< The scheduling policy. */
+  gint priority;              /**< The static priority for real-time policy. */
+  gchar *name;                /**< The thread name, truncated to 15 characters. */
+} ml_thread_attr_s;
+
+/**
+ * @brief Sets the scheduling attribute of given key. Returns #ML_ERROR_NOT_SUPPORTED if the key is not a thread attribute.
+ */
+int _ml_thread_attr_set (ml_thread_attr_s *attr, const char *key, const char *value);
+
+/**
+ * @brief Sets the scheduling attributes from the string values in ml_option instance.
+ */
+int _ml_thread_attr_set_from_option (ml_thread_attr_s *attr, ml_option_h option);
+
+/**
+ * @brief Gets the scheduling attribute of given key as a newly allocated string. Returns #ML_ERROR_NOT_SUPPORTED if the key is not a thread attribute.
+ */
+int _ml_thread_attr_get (const ml_thread_attr_s *attr, const char *key, char **value);
+
+/**
+ * @brief Checks whether any scheduling attribute is set.
+ */
+gboolean _ml_thread_attr_is_set (const ml_thread_attr_s *attr);
+
+/**
+ * @brief Copies the scheduling attributes.
+ */
+void _ml_thread_attr_copy (ml_thread_attr_s *dest, const ml_thread_attr_s *src);
+
+/**
+ * @brief Releases the scheduling attributes and resets it to the default.
+ */
+void _ml_thread_attr_clear (ml_thread_attr_s *attr);
+
+/**
+ * @brief Gets the id of the calling thread, to apply the scheduling attributes from other thread.
+ */
+int _ml_thread_get_id (void);
+
+/**
+ * @brief Applies the scheduling attributes to the thread.
+ * @param[in] attr The scheduling attributes to be applied.
+ * @param[in] tid The thread id from _ml_thread_get_id(), 0 for the calling thread.
+ * @param[out] saved The attributes of the thread before applying, to restore later. Set NULL if not needed.
+ * @return @c 0 on success. Otherwise a negative error value. The error is reported for each attribute which cannot be applied, and other attributes are applied.
+ * @retval #ML_ERROR_PERMISSION_DENIED The thread is not allowed to change the attribute (e.g., real-time policy or negative nice value without privilege).
+ * @retval #ML_ERROR_INVALID_PARAMETER The attribute is invalid in the system (e.g., no CPU in the list).
+ * @retval #ML_ERROR_NOT_SUPPORTED The platform does not support the attribute.
+ */
+int _ml_thread_attr_apply (const ml_thread_attr_s *attr, int tid, ml_thread_attr_s *saved);
+
 #if defined (__TIZEN__)
 /****** TIZEN CHECK FEATURE BEGINS *****/
 /**
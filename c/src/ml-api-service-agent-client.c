@@ -10,6 +10,7 @@
  * @bug No known bugs except for NYI items
  */
 
+#include <string.h>
 #include <glib/gstdio.h>
 #include <json-glib/json-glib.h>
 
@@ -17,6 +18,26 @@
 #include "ml-api-service-private.h"
 #include "ml-api-service.h"
 
+/**
+ * @brief The lifetime of the information from ml-service agent in the cache (2 seconds).
+ */
+#define AGENT_CACHE_TTL (2 * G_TIME_SPAN_SECOND)
+
+/**
+ * @brief The max number of entries in the cache of the information from ml-service agent.
+ */
+#define AGENT_CACHE_MAX_ENTRIES 128U
+
+/**
+ * @brief The max number of threads to fetch the information from ml-service agent at once.
+ */
+#define AGENT_FETCH_THREADS 8U
+
+/**
+ * @brief The max number of pre-launched pipelines for each service.
+ */
+#define MAX_PIPELINE_POOL_SIZE 8U
+
 #define WARN_MSG_DPTR_SET_OVER "The memory blocks pointed by pipeline_desc will be set over with a new one.\n" \
         "It is highly suggested that `%s` before it is set."
 
@@ -190,6 +211,649 @@ done:
   return ret;
 }
 
+/**
+ * @brief Enumeration for the type of the information in the cache.
+ */
+typedef enum
+{
+  ML_AGENT_CACHE_MODEL = 0,
+  ML_AGENT_CACHE_PIPELINE,
+  ML_AGENT_CACHE_RESOURCE,
+
+  ML_AGENT_CACHE_MAX
+} ml_agent_cache_type_e;
+
+/**
+ * @brief Internal structure for the information from ml-service agent in the cache.
+ */
+typedef struct
+{
+  gchar *value;
+  gint64 expire;
+} ml_agent_cache_entry_s;
+
+/**
+ * @brief Internal structure to wait for the information fetched in the worker threads.
+ */
+typedef struct
+{
+  GMutex lock;
+  GCond cond;
+  guint remaining; /**< The number of the requests not fetched yet. */
+} ml_agent_fetch_batch_s;
+
+/**
+ * @brief Internal structure to fetch the information from ml-service agent in the worker thread.
+ */
+typedef struct
+{
+  ml_agent_cache_type_e type;
+  const gchar *name;
+  gchar *value;
+  guint generation; /**< The generation of the key when the cache is missed. */
+  int status;
+  ml_agent_fetch_batch_s *batch;
+} ml_agent_fetch_s;
+
+/**
+ * @brief The cache of the information from ml-service agent (activated model, pipeline description and resources), to reduce the IPC.
+ */
+static GHashTable *agent_cache = NULL;
+G_LOCK_DEFINE_STATIC (agent_cache);
+
+/**
+ * @brief The generation of each key in the cache (key and generation), increased when the information is changed.
+ * The information fetched with old generation is not added in the cache. The key not in the table has the generation 'agent_cache_generation_base'.
+ */
+static GHashTable *agent_cache_generations = NULL;
+static guint agent_cache_generation_last = 0U;
+static guint agent_cache_generation_base = 0U;
+
+/**
+ * @brief The worker threads shared by the requests to fetch the information from ml-service agent concurrently.
+ */
+static GThreadPool *agent_fetch_pool = NULL;
+G_LOCK_DEFINE_STATIC (agent_fetch_pool);
+
+/**
+ * @brief Internal function to release the entry in the cache.
+ */
+static void
+_ml_agent_cache_entry_free (gpointer data)
+{
+  ml_agent_cache_entry_s *entry = (ml_agent_cache_entry_s *) data;
+
+  g_free (entry->value);
+  g_free (entry);
+}
+
+/**
+ * @brief Internal function to get the key of the cache.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_ml_agent_cache_get_key (ml_agent_cache_type_e type, const gchar * name)
+{
+  return g_strdup_printf ("%d:%s", (int) type, name);
+}
+
+/**
+ * @brief Internal function to get the generation of the key in the cache.
+ * @note This function should be called with the lock of the cache.
+ */
+static guint
+_ml_agent_cache_get_generation (const gchar * key)
+{
+  gpointer generation;
+
+  if (agent_cache_generations &&
+      g_hash_table_lookup_extended (agent_cache_generations, key, NULL,
+          &generation))
+    return GPOINTER_TO_UINT (generation);
+
+  return agent_cache_generation_base;
+}
+
+/**
+ * @brief Internal function to find the information in the cache.
+ * If the information is not in the cache, @a generation is set to add the information fetched from ml-service agent.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_ml_agent_cache_lookup (ml_agent_cache_type_e type, const gchar * name,
+    guint * generation)
+{
+  g_autofree gchar *key = _ml_agent_cache_get_key (type, name);
+  ml_agent_cache_entry_s *entry;
+  gchar *value = NULL;
+
+  G_LOCK (agent_cache);
+  *generation = _ml_agent_cache_get_generation (key);
+
+  if (agent_cache) {
+    entry = (ml_agent_cache_entry_s *) g_hash_table_lookup (agent_cache, key);
+
+    if (entry) {
+      if (entry->expire > g_get_monotonic_time ())
+        value = g_strdup (entry->value);
+      else
+        g_hash_table_remove (agent_cache, key);
+    }
+  }
+  G_UNLOCK (agent_cache);
+
+  return value;
+}
+
+/**
+ * @brief Internal function to check whether the entry in the cache is expired.
+ */
+static gboolean
+_ml_agent_cache_is_expired (gpointer key, gpointer value, gpointer user_data)
+{
+  ml_agent_cache_entry_s *entry = (ml_agent_cache_entry_s *) value;
+  gint64 now = *((gint64 *) user_data);
+
+  return (entry->expire <= now);
+}
+
+/**
+ * @brief Internal function to add the information in the cache.
+ * The information is not added if it is changed after the cache is missed (the generation is increased).
+ * The expired entries are swept when the cache is full, and the cache is cleared if it is still full.
+ */
+static void
+_ml_agent_cache_insert (ml_agent_cache_type_e type, const gchar * name,
+    const gchar * value, guint generation)
+{
+  g_autofree gchar *key = _ml_agent_cache_get_key (type, name);
+  ml_agent_cache_entry_s *entry;
+  gint64 now = g_get_monotonic_time ();
+
+  G_LOCK (agent_cache);
+  if (_ml_agent_cache_get_generation (key) != generation) {
+    G_UNLOCK (agent_cache);
+    return;
+  }
+
+  entry = g_new0 (ml_agent_cache_entry_s, 1);
+  entry->value = g_strdup (value);
+  entry->expire = now + AGENT_CACHE_TTL;
+
+  if (!agent_cache) {
+    agent_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+        _ml_agent_cache_entry_free);
+  }
+
+  if (g_hash_table_size (agent_cache) >= AGENT_CACHE_MAX_ENTRIES) {
+    g_hash_table_foreach_remove (agent_cache, _ml_agent_cache_is_expired, &now);
+
+    if (g_hash_table_size (agent_cache) >= AGENT_CACHE_MAX_ENTRIES)
+      g_hash_table_remove_all (agent_cache);
+  }
+
+  g_hash_table_insert (agent_cache, g_steal_pointer (&key), entry);
+  G_UNLOCK (agent_cache);
+}
+
+/**
+ * @brief Internal function to remove the information in the cache, when it is changed.
+ * The generation of the key is increased, so that the old one fetched concurrently is not added in the cache.
+ * @note Call this after ml-service agent updates the information.
+ */
+static void
+_ml_agent_cache_remove (ml_agent_cache_type_e type, const gchar * name)
+{
+  g_autofree gchar *key = _ml_agent_cache_get_key (type, name);
+
+  G_LOCK (agent_cache);
+  if (agent_cache)
+    g_hash_table_remove (agent_cache, key);
+
+  if (!agent_cache_generations) {
+    agent_cache_generations = g_hash_table_new_full (g_str_hash, g_str_equal,
+        g_free, NULL);
+  }
+
+  /* The keys not in the table get the last generation, which is newer than the generation before clearing. */
+  if (g_hash_table_size (agent_cache_generations) >= AGENT_CACHE_MAX_ENTRIES) {
+    g_hash_table_remove_all (agent_cache_generations);
+    agent_cache_generation_base = agent_cache_generation_last;
+  }
+
+  g_hash_table_insert (agent_cache_generations, g_steal_pointer (&key),
+      GUINT_TO_POINTER (++agent_cache_generation_last));
+  G_UNLOCK (agent_cache);
+}
+
+/**
+ * @brief Internal function to fetch the information from ml-service agent, and add it in the cache with the generation when the cache is missed.
+ */
+static int
+_ml_agent_cache_fetch (ml_agent_cache_type_e type, const gchar * name,
+    guint generation, gchar ** value)
+{
+  int ret = ML_ERROR_NONE;
+
+  switch (type) {
+    case ML_AGENT_CACHE_MODEL:
+      ret = ml_agent_model_get_activated (name, value);
+      break;
+    case ML_AGENT_CACHE_PIPELINE:
+      ret = ml_agent_pipeline_get_description (name, value);
+      break;
+    case ML_AGENT_CACHE_RESOURCE:
+      ret = ml_agent_resource_get (name, value);
+      break;
+    default:
+      ret = ML_ERROR_INVALID_PARAMETER;
+      break;
+  }
+
+  if (ML_ERROR_NONE == ret && *value)
+    _ml_agent_cache_insert (type, name, *value, generation);
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to get the information from the cache, or ml-service agent if it is not cached.
+ */
+static int
+_ml_agent_cache_get (ml_agent_cache_type_e type, const gchar * name,
+    gchar ** value)
+{
+  guint generation;
+
+  *value = _ml_agent_cache_lookup (type, name, &generation);
+  if (*value)
+    return ML_ERROR_NONE;
+
+  return _ml_agent_cache_fetch (type, name, generation, value);
+}
+
+/**
+ * @brief Internal function to fetch the information in the worker thread.
+ */
+static void
+_ml_agent_fetch_func (gpointer data, gpointer user_data)
+{
+  ml_agent_fetch_s *fetch = (ml_agent_fetch_s *) data;
+  ml_agent_fetch_batch_s *batch = fetch->batch;
+
+  fetch->status = _ml_agent_cache_fetch (fetch->type, fetch->name,
+      fetch->generation, &fetch->value);
+
+  if (batch) {
+    g_mutex_lock (&batch->lock);
+    batch->remaining--;
+    g_cond_signal (&batch->cond);
+    g_mutex_unlock (&batch->lock);
+  }
+}
+
+/**
+ * @brief Internal function to get the worker threads to fetch the information, the pool is created when it is used first.
+ */
+static GThreadPool *
+_ml_agent_fetch_get_pool (void)
+{
+  GThreadPool *pool;
+
+  G_LOCK (agent_fetch_pool);
+  if (!agent_fetch_pool) {
+    agent_fetch_pool = g_thread_pool_new (_ml_agent_fetch_func, NULL,
+        (gint) AGENT_FETCH_THREADS, FALSE, NULL);
+  }
+  pool = agent_fetch_pool;
+  G_UNLOCK (agent_fetch_pool);
+
+  return pool;
+}
+
+/**
+ * @brief Internal function to get the information of the names at once.
+ * The information not in the cache is fetched concurrently, so that it does not wait for the IPC sequentially.
+ */
+static int
+_ml_agent_cache_get_multi (ml_agent_cache_type_e type, const char **names,
+    unsigned int count, ml_agent_fetch_s * fetch)
+{
+  GThreadPool *pool = NULL;
+  ml_agent_fetch_batch_s batch;
+  unsigned int i, missed = 0;
+  int ret = ML_ERROR_NONE;
+
+  for (i = 0; i < count; i++) {
+    if (!names[i]) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, 'names' has NULL at index %u. It should be a valid string.",
+          i);
+    }
+  }
+
+  for (i = 0; i < count; i++) {
+    fetch[i].type = type;
+    fetch[i].name = names[i];
+    fetch[i].value = _ml_agent_cache_lookup (type, names[i],
+        &fetch[i].generation);
+    fetch[i].status = ML_ERROR_NONE;
+    fetch[i].batch = NULL;
+
+    if (!fetch[i].value)
+      missed++;
+  }
+
+  if (missed > 1)
+    pool = _ml_agent_fetch_get_pool ();
+
+  g_mutex_init (&batch.lock);
+  g_cond_init (&batch.cond);
+  batch.remaining = 0U;
+
+  for (i = 0; i < count; i++) {
+    if (fetch[i].value)
+      continue;
+
+    if (pool) {
+      /* The request stays in the queue even if the thread is not created, the other thread fetches it. */
+      g_mutex_lock (&batch.lock);
+      batch.remaining++;
+      g_mutex_unlock (&batch.lock);
+
+      fetch[i].batch = &batch;
+      g_thread_pool_push (pool, &fetch[i], NULL);
+    } else {
+      _ml_agent_fetch_func (&fetch[i], NULL);
+    }
+  }
+
+  /* Wait for the information fetched in the shared worker threads. */
+  g_mutex_lock (&batch.lock);
+  while (batch.remaining > 0U)
+    g_cond_wait (&batch.cond, &batch.lock);
+  g_mutex_unlock (&batch.lock);
+
+  g_mutex_clear (&batch.lock);
+  g_cond_clear (&batch.cond);
+
+  for (i = 0; i < count; i++) {
+    if (ML_ERROR_NONE != fetch[i].status || !fetch[i].value) {
+      _ml_error_report ("Failed to get the information of '%s'.",
+          fetch[i].name);
+      ret = (ML_ERROR_NONE != fetch[i].status) ?
+          fetch[i].status : ML_ERROR_INVALID_PARAMETER;
+      break;
+    }
+  }
+
+  if (ML_ERROR_NONE != ret) {
+    for (i = 0; i < count; i++) {
+      g_free (fetch[i].value);
+      fetch[i].value = NULL;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to remove the activated model of given name in the cache.
+ */
+void
+_ml_service_model_cache_invalidate (const char *name)
+{
+  if (name)
+    _ml_agent_cache_remove (ML_AGENT_CACHE_MODEL, name);
+}
+
+/**
+ * @brief Internal function to fetch the activated models of given names into the cache at once.
+ */
+int
+_ml_service_model_cache_prefetch (const char **names, unsigned int count)
+{
+  g_autofree ml_agent_fetch_s *fetch = NULL;
+  unsigned int i;
+  int ret;
+
+  if (!names || count == 0U)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  fetch = g_new0 (ml_agent_fetch_s, count);
+  ret = _ml_agent_cache_get_multi (ML_AGENT_CACHE_MODEL, names, count, fetch);
+
+  for (i = 0; i < count; i++)
+    g_free (fetch[i].value);
+
+  return ret;
+}
+
+/**
+ * @brief Internal structure for the pool of pre-launched pipelines of the service.
+ */
+typedef struct
+{
+  gchar *name; /**< The name of the service. */
+  guint size; /**< The number of pipelines to be kept in the pool. */
+  guint generation; /**< Increased when the pool is drained, to discard the pipeline launched with old description. */
+  gboolean refilling;
+  gboolean removed; /**< The pool is removed from the pools, the refill thread should stop. */
+  GThread *refill_thread;
+  GQueue ids; /**< The ids of pipelines launched in ml-service agent (PAUSED state). */
+} ml_agent_pipeline_pool_s;
+
+/**
+ * @brief The pools of pre-launched pipelines (service name and ml_agent_pipeline_pool_s).
+ */
+static GHashTable *pipeline_pools = NULL;
+G_LOCK_DEFINE_STATIC (pipeline_pools);
+
+/**
+ * @brief Internal function to destroy the pipelines in ml-service agent.
+ * @note This function invokes the IPC, do not call this with the lock of pipeline pools.
+ */
+static void
+_ml_agent_pipeline_destroy_ids (GQueue * ids)
+{
+  gint64 *id;
+
+  while ((id = (gint64 *) g_queue_pop_head (ids)) != NULL) {
+    ml_agent_pipeline_destroy (*id);
+    g_free (id);
+  }
+}
+
+/**
+ * @brief Internal function to move the pipelines in the pool to given queue, to be destroyed after unlocking.
+ * @note This function should be called with the lock of pipeline pools.
+ */
+static void
+_ml_agent_pipeline_pool_drain (ml_agent_pipeline_pool_s * pool, GQueue * stale)
+{
+  gint64 *id;
+
+  while ((id = (gint64 *) g_queue_pop_head (&pool->ids)) != NULL)
+    g_queue_push_tail (stale, id);
+
+  pool->generation++;
+}
+
+/**
+ * @brief Internal function to remove the pool from the pools.
+ * @note This function should be called with the lock of pipeline pools. The caller should release the pool using _ml_agent_pipeline_pool_free() after unlocking.
+ */
+static ml_agent_pipeline_pool_s *
+_ml_agent_pipeline_pool_steal (const gchar * name)
+{
+  ml_agent_pipeline_pool_s *pool = NULL;
+
+  if (pipeline_pools) {
+    pool = (ml_agent_pipeline_pool_s *) g_hash_table_lookup (pipeline_pools,
+        name);
+    if (pool) {
+      g_hash_table_steal (pipeline_pools, name);
+      pool->removed = TRUE;
+    }
+  }
+
+  return pool;
+}
+
+/**
+ * @brief Internal function to release the pool of pre-launched pipelines.
+ * @note This function waits for the refill thread and destroys the pipelines, do not call this with the lock of pipeline pools.
+ */
+static void
+_ml_agent_pipeline_pool_free (ml_agent_pipeline_pool_s * pool)
+{
+  if (!pool)
+    return;
+
+  if (pool->refill_thread)
+    g_thread_join (pool->refill_thread);
+
+  _ml_agent_pipeline_destroy_ids (&pool->ids);
+  g_free (pool->name);
+  g_free (pool);
+}
+
+/**
+ * @brief Internal function to launch the pipelines in background until the pool is full.
+ */
+static gpointer
+_ml_agent_pipeline_pool_refill (gpointer data)
+{
+  ml_agent_pipeline_pool_s *pool = (ml_agent_pipeline_pool_s *) data;
+  guint generation;
+  gint64 id;
+  gint64 *pooled;
+  int ret;
+
+  while (TRUE) {
+    G_LOCK (pipeline_pools);
+    if (pool->removed || g_queue_get_length (&pool->ids) >= pool->size) {
+      pool->refilling = FALSE;
+      G_UNLOCK (pipeline_pools);
+      break;
+    }
+    generation = pool->generation;
+    G_UNLOCK (pipeline_pools);
+
+    /* Construct the pipeline and load the models, ml-service agent keeps it in PAUSED state. */
+    ret = ml_agent_pipeline_launch (pool->name, &id);
+
+    G_LOCK (pipeline_pools);
+    if (ret < 0) {
+      _ml_loge ("Failed to launch the pipeline '%s' for the pool.", pool->name);
+      pool->refilling = FALSE;
+      G_UNLOCK (pipeline_pools);
+      break;
+    }
+
+    if (!pool->removed && pool->generation == generation &&
+        g_queue_get_length (&pool->ids) < pool->size) {
+      pooled = g_new (gint64, 1);
+      *pooled = id;
+      g_queue_push_tail (&pool->ids, pooled);
+      id = 0;
+    }
+    G_UNLOCK (pipeline_pools);
+
+    /* The pool is drained or resized while launching the pipeline. */
+    if (id > 0)
+      ml_agent_pipeline_destroy (id);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to start refilling the pool in background.
+ * @note This function should be called with the lock of pipeline pools.
+ */
+static void
+_ml_agent_pipeline_pool_start_refill (ml_agent_pipeline_pool_s * pool)
+{
+  if (pool->removed || pool->refilling ||
+      g_queue_get_length (&pool->ids) >= pool->size)
+    return;
+
+  /* The previous refill thread is done (it does not hold the lock after clearing the flag). */
+  if (pool->refill_thread) {
+    g_thread_join (pool->refill_thread);
+    pool->refill_thread = NULL;
+  }
+
+  pool->refill_thread = g_thread_try_new ("ml-pipeline-pool",
+      _ml_agent_pipeline_pool_refill, pool, NULL);
+  if (pool->refill_thread) {
+    pool->refilling = TRUE;
+  } else {
+    _ml_loge ("Failed to create the thread to launch the pipeline '%s'.",
+        pool->name);
+  }
+}
+
+/**
+ * @brief Internal function to take the pre-launched pipeline from the pool.
+ * @return TRUE if the pipeline is taken from the pool.
+ */
+static gboolean
+_ml_agent_pipeline_pool_take (const gchar * name, int64_t * id)
+{
+  ml_agent_pipeline_pool_s *pool;
+  gint64 *pooled = NULL;
+  gint state;
+
+  G_LOCK (pipeline_pools);
+  pool = pipeline_pools ?
+      (ml_agent_pipeline_pool_s *) g_hash_table_lookup (pipeline_pools,
+      name) : NULL;
+  if (pool) {
+    pooled = (gint64 *) g_queue_pop_head (&pool->ids);
+    _ml_agent_pipeline_pool_start_refill (pool);
+  }
+  G_UNLOCK (pipeline_pools);
+
+  if (!pooled)
+    return FALSE;
+
+  *id = *pooled;
+  g_free (pooled);
+
+  /* Check the pipeline is still alive in ml-service agent. */
+  if (ml_agent_pipeline_get_state (*id, &state) < 0) {
+    _ml_logw ("The pre-launched pipeline of '%s' is not available.", name);
+    *id = 0;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to destroy the pre-launched pipelines and launch new pipelines, when the description is changed.
+ */
+static void
+_ml_agent_pipeline_pool_invalidate (const gchar * name)
+{
+  ml_agent_pipeline_pool_s *pool;
+  GQueue stale = G_QUEUE_INIT;
+
+  G_LOCK (pipeline_pools);
+  pool = pipeline_pools ?
+      (ml_agent_pipeline_pool_s *) g_hash_table_lookup (pipeline_pools,
+      name) : NULL;
+  if (pool) {
+    _ml_agent_pipeline_pool_drain (pool, &stale);
+    _ml_agent_pipeline_pool_start_refill (pool);
+  }
+  G_UNLOCK (pipeline_pools);
+
+  _ml_agent_pipeline_destroy_ids (&stale);
+}
+
 /**
  * @brief Internal function to check the path of model or resource.
  */
@@ -247,8 +911,12 @@ ml_service_pipeline_set (const char *name, const char *pipeline_desc)
   }
 
   ret = ml_agent_pipeline_set_description (name, pipeline_desc);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_PIPELINE, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method set_pipeline.");
+  } else {
+    /* Launch the pipelines with new description. */
+    _ml_agent_pipeline_pool_invalidate (name);
   }
 
   return ret;
@@ -279,7 +947,7 @@ ml_service_pipeline_get (const char *name, char **pipeline_desc)
     *pipeline_desc = NULL;
   }
 
-  ret = ml_agent_pipeline_get_description (name, pipeline_desc);
+  ret = _ml_agent_cache_get (ML_AGENT_CACHE_PIPELINE, name, pipeline_desc);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method get_pipeline.");
   }
@@ -294,6 +962,7 @@ int
 ml_service_pipeline_delete (const char *name)
 {
   int ret = ML_ERROR_NONE;
+  ml_agent_pipeline_pool_s *pool;
 
   check_feature_state (ML_FEATURE_SERVICE);
 
@@ -302,7 +971,14 @@ ml_service_pipeline_delete (const char *name)
         "The parameter, 'name' is NULL, It should be a valid string.");
   }
 
+  G_LOCK (pipeline_pools);
+  pool = _ml_agent_pipeline_pool_steal (name);
+  G_UNLOCK (pipeline_pools);
+
+  _ml_agent_pipeline_pool_free (pool);
+
   ret = ml_agent_pipeline_delete (name);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_PIPELINE, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method delete_pipeline.");
   }
@@ -345,7 +1021,12 @@ ml_service_pipeline_launch (const char *name, ml_service_h * handle)
         "Failed to allocate memory for the service handle's private data. Out of memory?");
   }
 
-  ret = ml_agent_pipeline_launch (name, &(server->id));
+  /* Take the pre-launched pipeline, then the caller only starts it. */
+  if (name && _ml_agent_pipeline_pool_take (name, &(server->id)))
+    ret = ML_ERROR_NONE;
+  else
+    ret = ml_agent_pipeline_launch (name, &(server->id));
+
   if (ret < 0) {
     _ml_service_destroy_internal (mls);
     _ml_error_report_return (ret,
@@ -451,6 +1132,8 @@ ml_service_model_register (const char *name, const char *path,
 
   ret = ml_agent_model_register (name, path, activate,
       description ? description : "", app_info ? app_info : "", version);
+  if (activate)
+    _ml_agent_cache_remove (ML_AGENT_CACHE_MODEL, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method model_register.");
   }
@@ -485,6 +1168,7 @@ ml_service_model_update_description (const char *name,
   }
 
   ret = ml_agent_model_update_description (name, version, description);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_MODEL, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method model_update_description.");
   }
@@ -513,6 +1197,7 @@ ml_service_model_activate (const char *name, const unsigned int version)
   }
 
   ret = ml_agent_model_activate (name, version);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_MODEL, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method model_activate.");
   }
@@ -591,7 +1276,7 @@ ml_service_model_get_activated (const char *name, ml_information_h * info)
   }
   *info = NULL;
 
-  ret = ml_agent_model_get_activated (name, &description);
+  ret = _ml_agent_cache_get (ML_AGENT_CACHE_MODEL, name, &description);
   if (ML_ERROR_NONE != ret || !description) {
     _ml_error_report ("Failed to invoke the method model_get_activated.");
     return ret;
@@ -659,6 +1344,7 @@ ml_service_model_delete (const char *name, const unsigned int version)
   }
 
   ret = ml_agent_model_delete (name, version, FALSE);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_MODEL, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method model_delete.");
   }
@@ -691,6 +1377,7 @@ ml_service_resource_add (const char *name, const char *path,
 
   ret = ml_agent_resource_add (name, path, description ? description : "",
       app_info ? app_info : "");
+  _ml_agent_cache_remove (ML_AGENT_CACHE_RESOURCE, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method resource_add.");
   }
@@ -714,6 +1401,7 @@ ml_service_resource_delete (const char *name)
   }
 
   ret = ml_agent_resource_delete (name);
+  _ml_agent_cache_remove (ML_AGENT_CACHE_RESOURCE, name);
   if (ret < 0) {
     _ml_error_report ("Failed to invoke the method resource_delete.");
   }
@@ -748,7 +1436,7 @@ ml_service_resource_get (const char *name, ml_information_list_h * res)
   }
   *res = NULL;
 
-  ret = ml_agent_resource_get (name, &res_info);
+  ret = _ml_agent_cache_get (ML_AGENT_CACHE_RESOURCE, name, &res_info);
   if (ML_ERROR_NONE != ret || !res_info) {
     _ml_error_report_return (ret, "Failed to invoke the method resource_get.");
   }
@@ -761,3 +1449,224 @@ ml_service_resource_get (const char *name, ml_information_list_h * res)
 
   return ret;
 }
+
+/**
+ * @brief Gets the information of activated neural network models with given @a names at once.
+ */
+int
+ml_service_model_get_activated_multi (const char **names,
+    const unsigned int count, ml_information_h * info)
+{
+  g_autofree ml_agent_fetch_s *fetch = NULL;
+  unsigned int i;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!names || count == 0U) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'names' is NULL or 'count' is 0. It should be a valid array of string.");
+  }
+
+  if (info == NULL) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument for 'info' should not be NULL.");
+  }
+
+  memset (info, 0, sizeof (ml_information_h) * count);
+
+  fetch = g_new0 (ml_agent_fetch_s, count);
+  ret = _ml_agent_cache_get_multi (ML_AGENT_CACHE_MODEL, names, count, fetch);
+  if (ML_ERROR_NONE != ret)
+    return ret;
+
+  for (i = 0; i < count; i++) {
+    if (ML_ERROR_NONE == ret) {
+      ret = _build_ml_info_from_json_cstr (fetch[i].value, &info[i]);
+      if (ML_ERROR_NONE != ret)
+        _ml_error_report ("Failed to convert json string to ml_information_h.");
+    }
+
+    g_free (fetch[i].value);
+  }
+
+  if (ML_ERROR_NONE != ret) {
+    for (i = 0; i < count; i++) {
+      if (info[i])
+        ml_information_destroy (info[i]);
+      info[i] = NULL;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Gets the pipeline descriptions with given @a names at once.
+ */
+int
+ml_service_pipeline_get_multi (const char **names, const unsigned int count,
+    char **pipeline_desc)
+{
+  g_autofree ml_agent_fetch_s *fetch = NULL;
+  unsigned int i;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!names || count == 0U) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'names' is NULL or 'count' is 0. It should be a valid array of string.");
+  }
+
+  if (pipeline_desc == NULL) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument for 'pipeline_desc' should not be NULL.");
+  }
+
+  memset (pipeline_desc, 0, sizeof (char *) * count);
+
+  fetch = g_new0 (ml_agent_fetch_s, count);
+  ret = _ml_agent_cache_get_multi (ML_AGENT_CACHE_PIPELINE, names, count,
+      fetch);
+  if (ML_ERROR_NONE != ret)
+    return ret;
+
+  for (i = 0; i < count; i++)
+    pipeline_desc[i] = fetch[i].value;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the number of pre-launched pipelines of the service.
+ */
+int
+ml_service_pipeline_set_pool_size (const char *name, const unsigned int size)
+{
+  ml_agent_pipeline_pool_s *pool;
+  ml_agent_pipeline_pool_s *removed = NULL;
+  GQueue stale = G_QUEUE_INIT;
+  g_autofree gchar *desc = NULL;
+  int ret;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!name) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'name' is NULL. It should be a valid string.");
+  }
+
+  if (size > MAX_PIPELINE_POOL_SIZE) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'size' (%u) is invalid. It should be less than or equal to %u.",
+        size, MAX_PIPELINE_POOL_SIZE);
+  }
+
+  if (size > 0U) {
+    /* Check the pipeline is registered. */
+    ret = _ml_agent_cache_get (ML_AGENT_CACHE_PIPELINE, name, &desc);
+    if (ML_ERROR_NONE != ret || !desc) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to get the pipeline '%s', it should be registered before setting the pool.",
+          name);
+    }
+  }
+
+  G_LOCK (pipeline_pools);
+  if (!pipeline_pools) {
+    /* The key is the name in the pool, the pool is released with _ml_agent_pipeline_pool_free(). */
+    pipeline_pools = g_hash_table_new (g_str_hash, g_str_equal);
+  }
+
+  pool = (ml_agent_pipeline_pool_s *) g_hash_table_lookup (pipeline_pools,
+      name);
+
+  if (size == 0U) {
+    removed = _ml_agent_pipeline_pool_steal (name);
+  } else {
+    if (!pool) {
+      pool = g_new0 (ml_agent_pipeline_pool_s, 1);
+      pool->name = g_strdup (name);
+      g_queue_init (&pool->ids);
+      g_hash_table_insert (pipeline_pools, pool->name, pool);
+    }
+
+    pool->size = size;
+    while (g_queue_get_length (&pool->ids) > size)
+      g_queue_push_tail (&stale, g_queue_pop_tail (&pool->ids));
+
+    _ml_agent_pipeline_pool_start_refill (pool);
+  }
+  G_UNLOCK (pipeline_pools);
+
+  _ml_agent_pipeline_destroy_ids (&stale);
+  _ml_agent_pipeline_pool_free (removed);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the number of pre-launched pipelines ready in the pool of the service.
+ */
+int
+ml_service_pipeline_get_pool_available (const char *name, unsigned int *count)
+{
+  ml_agent_pipeline_pool_s *pool;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!name) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'name' is NULL. It should be a valid string.");
+  }
+
+  if (!count) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'count' is NULL. It should be a valid pointer to get the number of pipelines.");
+  }
+
+  G_LOCK (pipeline_pools);
+  pool = pipeline_pools ?
+      (ml_agent_pipeline_pool_s *) g_hash_table_lookup (pipeline_pools,
+      name) : NULL;
+  *count = pool ? g_queue_get_length (&pool->ids) : 0U;
+  G_UNLOCK (pipeline_pools);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Destroys the pre-launched pipelines of all services.
+ * The pipelines in the pool are launched in ml-service agent, these are not released with the process.
+ */
+int
+ml_service_pipeline_clear_pools (void)
+{
+  GHashTable *pools;
+  GHashTableIter iter;
+  gpointer value;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  G_LOCK (pipeline_pools);
+  pools = pipeline_pools;
+  pipeline_pools = NULL;
+
+  if (pools) {
+    g_hash_table_iter_init (&iter, pools);
+    while (g_hash_table_iter_next (&iter, NULL, &value))
+      ((ml_agent_pipeline_pool_s *) value)->removed = TRUE;
+  }
+  G_UNLOCK (pipeline_pools);
+
+  if (!pools)
+    return ML_ERROR_NONE;
+
+  g_hash_table_iter_init (&iter, pools);
+  while (g_hash_table_iter_next (&iter, NULL, &value))
+    _ml_agent_pipeline_pool_free ((ml_agent_pipeline_pool_s *) value);
+
+  g_hash_table_destroy (pools);
+  return ML_ERROR_NONE;
+}
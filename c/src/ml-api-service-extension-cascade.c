@@ -0,0 +1,530 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-cascade.c
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, cascade (early-exit) of single-shot models.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+
+#include "ml-api-service-extension.h"
+#include "ml-api-service-extension-cascade.h"
+#include "ml-api-inference-pipeline-internal.h"
+#include "ml-api-inference-single-internal.h"
+
+/**
+ * @brief Internal structure of the stage in the cascade.
+ */
+typedef struct
+{
+  gchar *name;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_info_h out_info;
+
+  /**
+   * The rule to decide the input exits at this stage. The last stage has no rule, all inputs exit.
+   * - threshold : The top-1 score of the output tensor is equal to or greater than the threshold.
+   * - custom : The registered tensor_if custom condition returns non-zero result.
+   */
+  gboolean has_rule;
+  guint tensor; /**< The index of output tensor to get top-1 score. */
+  gdouble threshold; /**< The threshold in the scale of output tensor. */
+  ml_pipeline_if_h custom;
+
+  guint64 exited; /**< The number of inputs which exit at this stage. */
+} ml_extension_cascade_stage_s;
+
+/**
+ * @brief Internal structure for the cascade of single-shot models.
+ */
+struct _ml_extension_cascade_s
+{
+  ml_service_s *mls;
+  GPtrArray *stages; /**< The stages in order of the invoke. */
+
+  GMutex lock; /**< The lock for the statistics. */
+  guint64 inputs; /**< The number of processed inputs. */
+};
+
+/**
+ * @brief Internal function to release the stage in the cascade.
+ */
+static void
+_ml_extension_cascade_stage_free (gpointer data)
+{
+  ml_extension_cascade_stage_s *stage = (ml_extension_cascade_stage_s *) data;
+
+  if (!stage)
+    return;
+
+  if (stage->single)
+    ml_single_close (stage->single);
+  if (stage->in_info)
+    ml_tensors_info_destroy (stage->in_info);
+  if (stage->out_info)
+    ml_tensors_info_destroy (stage->out_info);
+  if (stage->custom)
+    _ml_pipeline_if_custom_release (stage->custom);
+
+  g_free (stage->name);
+  g_free (stage);
+}
+
+/**
+ * @brief Internal function to find the stage in the cascade.
+ */
+static ml_extension_cascade_stage_s *
+_ml_extension_cascade_stage_find (ml_extension_cascade_s * cascade,
+    const gchar * name)
+{
+  ml_extension_cascade_stage_s *stage;
+  guint i;
+
+  if (!STR_IS_VALID (name))
+    return NULL;
+
+  for (i = 0; i < cascade->stages->len; i++) {
+    stage = g_ptr_array_index (cascade->stages, i);
+
+    if (g_ascii_strcasecmp (stage->name, name) == 0)
+      return stage;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to parse the exit rule of the stage.
+ */
+static int
+_ml_extension_cascade_parse_exit (ml_extension_cascade_stage_s * stage,
+    JsonObject * object)
+{
+  const gchar *custom;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0U;
+
+  custom = _ml_service_get_json_string_member (object, "custom");
+
+  if (STR_IS_VALID (custom)) {
+    stage->custom = _ml_pipeline_if_custom_get (custom);
+    if (!stage->custom) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to parse configuration file, cannot find the custom condition '%s' of stage '%s'. It should be registered with ml_pipeline_tensor_if_custom_register().",
+          custom, stage->name);
+    }
+  } else if (json_object_has_member (object, "threshold")) {
+    JsonNode *node = json_object_get_member (object, "threshold");
+    GType vtype = JSON_NODE_HOLDS_VALUE (node) ?
+        json_node_get_value_type (node) : G_TYPE_INVALID;
+
+    /* The threshold should be a number, json-glib returns 0 for other types. */
+    if (vtype != G_TYPE_DOUBLE && vtype != G_TYPE_INT64) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to parse configuration file, the threshold of stage '%s' should be a number.",
+          stage->name);
+    }
+
+    stage->threshold = json_node_get_double (node);
+
+    if (json_object_has_member (object, "tensor"))
+      stage->tensor = (guint) json_object_get_int_member (object, "tensor");
+
+    ml_tensors_info_get_count (stage->out_info, &count);
+    if (stage->tensor >= count) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to parse configuration file, the tensor index %u of stage '%s' is out of range (%u).",
+          stage->tensor, stage->name, count);
+    }
+
+    ml_tensors_info_get_tensor_type (stage->out_info, stage->tensor, &type);
+    if (type == ML_TENSOR_TYPE_FLOAT16 || type == ML_TENSOR_TYPE_UNKNOWN) {
+      _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+          "Failed to parse configuration file, cannot get the score from the output tensor of stage '%s', the tensor type is not supported.",
+          stage->name);
+    }
+  } else {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, the exit rule of stage '%s' should have the threshold or custom condition.",
+        stage->name);
+  }
+
+  stage->has_rule = TRUE;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to parse the stage in the cascade.
+ */
+static int
+_ml_extension_cascade_stage_parse (ml_extension_cascade_s * cascade,
+    JsonObject * object, gboolean is_last)
+{
+  ml_extension_cascade_stage_s *stage, *first;
+  ml_option_h option = NULL;
+  const gchar *name;
+  int status;
+
+  name = _ml_service_get_json_string_member (object, "name");
+  if (!STR_IS_VALID (name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, the stage in the cascade should have valid name.");
+  }
+
+  if (_ml_extension_cascade_stage_find (cascade, name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot add duplicated stage '%s' in the cascade.",
+        name);
+  }
+
+  stage = g_try_new0 (ml_extension_cascade_stage_s, 1);
+  if (!stage) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate new memory for the stage in the cascade. Out of memory?");
+  }
+
+  stage->name = g_strdup (name);
+  g_ptr_array_add (cascade->stages, stage);
+
+  status = ml_option_create (&option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot create ml-option handle.");
+    goto done;
+  }
+
+  status = _ml_service_extension_conf_parse_single_option (object, option,
+      NULL, NULL);
+  if (status == ML_ERROR_NONE)
+    status = ml_single_open_with_option (&stage->single, option);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot open the model of stage '%s'.",
+        name);
+    goto done;
+  }
+
+  ml_single_get_input_info (stage->single, &stage->in_info);
+  ml_single_get_output_info (stage->single, &stage->out_info);
+
+  /* All stages take the input of the cascade. */
+  first = g_ptr_array_index (cascade->stages, 0);
+  if (first != stage && !ml_tensors_info_is_equal (first->in_info,
+          stage->in_info)) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    _ml_error_report
+        ("Failed to parse configuration file, the input of stage '%s' is different from the input of the cascade.",
+        name);
+    goto done;
+  }
+
+  if (json_object_has_member (object, "exit")) {
+    if (is_last) {
+      _ml_logw ("The last stage '%s' in the cascade ignores the exit rule.",
+          name);
+    } else {
+      status = _ml_extension_cascade_parse_exit (stage,
+          json_object_get_object_member (object, "exit"));
+    }
+  } else if (!is_last) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    _ml_error_report
+        ("Failed to parse configuration file, the stage '%s' should have the exit rule except the last stage.",
+        name);
+  }
+
+done:
+  if (option)
+    ml_option_destroy (option);
+  return status;
+}
+
+/**
+ * @brief Macro to get the max value of the tensor data in given type.
+ */
+#define CASCADE_GET_MAX(type,raw,size,score) do { \
+    const type *_v = (const type *) (raw); \
+    gsize _i, _n = (size) / sizeof (type); \
+    for (_i = 0; _i < _n; _i++) { \
+      if (_i == 0 || (gdouble) _v[_i] > (score)) \
+        (score) = (gdouble) _v[_i]; \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to get the top-1 score of the output tensor.
+ */
+static gdouble
+_ml_extension_cascade_get_score (ml_extension_cascade_stage_s * stage,
+    const ml_tensors_data_h output)
+{
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) output;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  gpointer raw;
+  gsize size;
+  gdouble score = 0.0;
+
+  ml_tensors_info_get_tensor_type (stage->out_info, stage->tensor, &type);
+
+  raw = _data->tensors[stage->tensor].data;
+  size = _data->tensors[stage->tensor].size;
+
+  switch (type) {
+    case ML_TENSOR_TYPE_INT32:
+      CASCADE_GET_MAX (int32_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      CASCADE_GET_MAX (uint32_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      CASCADE_GET_MAX (int16_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      CASCADE_GET_MAX (uint16_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_INT8:
+      CASCADE_GET_MAX (int8_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      CASCADE_GET_MAX (uint8_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_FLOAT64:
+      CASCADE_GET_MAX (double, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      CASCADE_GET_MAX (float, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      CASCADE_GET_MAX (int64_t, raw, size, score);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      CASCADE_GET_MAX (uint64_t, raw, size, score);
+      break;
+    default:
+      /* Unsupported type is rejected when parsing the configuration. */
+      break;
+  }
+
+  return score;
+}
+
+/**
+ * @brief Internal function to check the input exits at the stage.
+ */
+static gboolean
+_ml_extension_cascade_stage_exit (ml_extension_cascade_stage_s * stage,
+    const ml_tensors_data_h output)
+{
+  int result = 0;
+
+  if (!stage->has_rule)
+    return TRUE;
+
+  if (stage->custom) {
+    /* Forward the input to next stage if the custom condition is failed. */
+    if (_ml_pipeline_if_custom_invoke (stage->custom, output, stage->out_info,
+            &result) != ML_ERROR_NONE)
+      return FALSE;
+
+    return (result != 0);
+  }
+
+  return (_ml_extension_cascade_get_score (stage, output) >= stage->threshold);
+}
+
+/**
+ * @brief Internal function to create the cascade of single-shot models from json.
+ */
+int
+_ml_service_extension_cascade_create (ml_service_s * mls, JsonObject * object,
+    ml_extension_cascade_s ** cascade)
+{
+  ml_extension_cascade_s *c;
+  JsonArray *array = NULL;
+  guint i, n = 0;
+  int status = ML_ERROR_NONE;
+
+  if (json_object_has_member (object, "stages"))
+    array = json_object_get_array_member (object, "stages");
+  if (array)
+    n = json_array_get_length (array);
+
+  if (n == 0) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot find the stages of the cascade.");
+  }
+
+  c = g_try_new0 (ml_extension_cascade_s, 1);
+  if (!c) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the cascade in ml-service extension. Out of memory?");
+  }
+
+  c->mls = mls;
+  c->stages = g_ptr_array_new_with_free_func (_ml_extension_cascade_stage_free);
+  g_mutex_init (&c->lock);
+
+  for (i = 0; i < n; i++) {
+    status = _ml_extension_cascade_stage_parse (c,
+        json_array_get_object_element (array, i), (i == n - 1));
+    if (status != ML_ERROR_NONE)
+      break;
+  }
+
+  if (status == ML_ERROR_NONE)
+    *cascade = c;
+  else
+    _ml_service_extension_cascade_destroy (c);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to release the cascade of single-shot models.
+ */
+void
+_ml_service_extension_cascade_destroy (ml_extension_cascade_s * cascade)
+{
+  if (!cascade)
+    return;
+
+  if (cascade->stages) {
+    g_ptr_array_free (cascade->stages, TRUE);
+    cascade->stages = NULL;
+  }
+
+  g_mutex_clear (&cascade->lock);
+  g_free (cascade);
+}
+
+/**
+ * @brief Internal function to process the input data with the cascade and invoke new-data event for the stage where the input exits.
+ * All stages read the same input data, the input is not copied between the stages.
+ */
+int
+_ml_service_extension_cascade_invoke (ml_extension_cascade_s * cascade,
+    const ml_tensors_data_h input)
+{
+  ml_extension_cascade_stage_s *stage;
+  ml_tensors_data_h output;
+  gboolean done = FALSE;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  for (i = 0; i < cascade->stages->len && !done; i++) {
+    stage = g_ptr_array_index (cascade->stages, i);
+    output = NULL;
+
+    status = _ml_single_invoke_no_copy (stage->single, input, &output);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report ("Failed to invoke the model of stage '%s' in the cascade.",
+          stage->name);
+      break;
+    }
+
+    done = _ml_extension_cascade_stage_exit (stage, output);
+
+    if (done) {
+      g_mutex_lock (&cascade->lock);
+      cascade->inputs++;
+      stage->exited++;
+      g_mutex_unlock (&cascade->lock);
+
+      _ml_service_invoke_event_new_data (cascade->mls, stage->name, output);
+    }
+
+    ml_tensors_data_destroy (output);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int
+_ml_service_extension_cascade_get_input_information (ml_extension_cascade_s *
+    cascade, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_cascade_stage_s *stage;
+
+  /* All stages take the same input, the name is optional. */
+  if (STR_IS_VALID (name))
+    stage = _ml_extension_cascade_stage_find (cascade, name);
+  else
+    stage = g_ptr_array_index (cascade->stages, 0);
+
+  if (!stage)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (stage->in_info, info);
+}
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int
+_ml_service_extension_cascade_get_output_information (ml_extension_cascade_s *
+    cascade, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_cascade_stage_s *stage;
+
+  /* The last stage gives the output if the name is not given. */
+  if (STR_IS_VALID (name))
+    stage = _ml_extension_cascade_stage_find (cascade, name);
+  else
+    stage = g_ptr_array_index (cascade->stages, cascade->stages->len - 1);
+
+  if (!stage)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (stage->out_info, info);
+}
+
+/**
+ * @brief Internal function to get the statistics of the cascade.
+ * (cascade_inputs, cascade_exit_<index or name>)
+ */
+int
+_ml_service_extension_cascade_get_information (ml_extension_cascade_s *
+    cascade, const char *name, gchar ** value)
+{
+  ml_extension_cascade_stage_s *stage = NULL;
+  const gchar *key;
+  gchar *endptr = NULL;
+  guint64 index;
+
+  if (g_ascii_strcasecmp (name, "cascade_inputs") == 0) {
+    g_mutex_lock (&cascade->lock);
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT, cascade->inputs);
+    g_mutex_unlock (&cascade->lock);
+    return ML_ERROR_NONE;
+  }
+
+  if (!g_str_has_prefix (name, "cascade_exit_"))
+    return ML_ERROR_INVALID_PARAMETER;
+
+  key = name + strlen ("cascade_exit_");
+  index = g_ascii_strtoull (key, &endptr, 10);
+
+  if (endptr != key && *endptr == '\0') {
+    if (index < cascade->stages->len)
+      stage = g_ptr_array_index (cascade->stages, index);
+  } else {
+    stage = _ml_extension_cascade_stage_find (cascade, key);
+  }
+
+  if (!stage)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&cascade->lock);
+  *value = g_strdup_printf ("%" G_GUINT64_FORMAT, stage->exited);
+  g_mutex_unlock (&cascade->lock);
+
+  return ML_ERROR_NONE;
+}
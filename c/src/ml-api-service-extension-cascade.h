@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-cascade.h
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, cascade (early-exit) of single-shot models.
+ *              This file should NOT be exported to SDK or devel package.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+#ifndef __ML_API_SERVICE_EXTENSION_CASCADE_H__
+#define __ML_API_SERVICE_EXTENSION_CASCADE_H__
+
+#include "ml-api-service-private.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Internal structure for the cascade of single-shot models in ml-service extension.
+ */
+typedef struct _ml_extension_cascade_s ml_extension_cascade_s;
+
+/**
+ * @brief Internal function to create the cascade of single-shot models from json.
+ */
+int _ml_service_extension_cascade_create (ml_service_s *mls, JsonObject *object, ml_extension_cascade_s **cascade);
+
+/**
+ * @brief Internal function to release the cascade of single-shot models.
+ */
+void _ml_service_extension_cascade_destroy (ml_extension_cascade_s *cascade);
+
+/**
+ * @brief Internal function to process the input data with the cascade and invoke new-data event for the stage where the input exits.
+ */
+int _ml_service_extension_cascade_invoke (ml_extension_cascade_s *cascade, const ml_tensors_data_h input);
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int _ml_service_extension_cascade_get_input_information (ml_extension_cascade_s *cascade, const char *name, ml_tensors_info_h *info);
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int _ml_service_extension_cascade_get_output_information (ml_extension_cascade_s *cascade, const char *name, ml_tensors_info_h *info);
+
+/**
+ * @brief Internal function to get the statistics of the cascade.
+ */
+int _ml_service_extension_cascade_get_information (ml_extension_cascade_s *cascade, const char *name, gchar **value);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __ML_API_SERVICE_EXTENSION_CASCADE_H__ */
@@ -0,0 +1,595 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-graph.c
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, graph of single-shot models.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+
+#include "ml-api-service-extension.h"
+#include "ml-api-service-extension-graph.h"
+
+/**
+ * @brief Internal structure of the node in the graph.
+ */
+typedef struct
+{
+  gchar *name;
+  guint index;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_info_h out_info;
+  GPtrArray *inputs; /**< The nodes providing input tensors (empty if the node takes the input of the graph). */
+  GPtrArray *outputs; /**< The nodes consuming output tensors. */
+  gboolean is_output;
+} ml_extension_graph_node_s;
+
+/**
+ * @brief Internal structure for the graph of single-shot models.
+ */
+struct _ml_extension_graph_s
+{
+  ml_service_s *mls;
+  GPtrArray *nodes; /**< The nodes in topological order. */
+  GThreadPool *pool; /**< The worker pool to run independent nodes in parallel. */
+
+  GMutex lock;
+  GCond cond;
+  ml_tensors_data_h input; /**< The input data of the graph. */
+  ml_tensors_data_h *results; /**< The output data of each node. */
+  guint *pending; /**< The number of input nodes to be finished for each node. */
+  guint remaining; /**< The number of nodes to be finished. */
+  int status;
+};
+
+/**
+ * @brief Internal function to release the node in the graph.
+ */
+static void
+_ml_extension_graph_node_free (gpointer data)
+{
+  ml_extension_graph_node_s *node = (ml_extension_graph_node_s *) data;
+
+  if (!node)
+    return;
+
+  if (node->single)
+    ml_single_close (node->single);
+  if (node->in_info)
+    ml_tensors_info_destroy (node->in_info);
+  if (node->out_info)
+    ml_tensors_info_destroy (node->out_info);
+
+  g_ptr_array_free (node->inputs, TRUE);
+  g_ptr_array_free (node->outputs, TRUE);
+  g_free (node->name);
+  g_free (node);
+}
+
+/**
+ * @brief Internal function to find the node in the graph.
+ */
+static ml_extension_graph_node_s *
+_ml_extension_graph_node_find (ml_extension_graph_s * graph,
+    const gchar * name)
+{
+  ml_extension_graph_node_s *node;
+  guint i;
+
+  if (!STR_IS_VALID (name))
+    return NULL;
+
+  for (i = 0; i < graph->nodes->len; i++) {
+    node = g_ptr_array_index (graph->nodes, i);
+
+    if (g_ascii_strcasecmp (node->name, name) == 0)
+      return node;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to parse the node names from json.
+ */
+static int
+_ml_extension_graph_parse_names (JsonNode * node, gchar *** names)
+{
+  g_autofree gchar *str = NULL;
+  int status;
+
+  status = _ml_service_conf_parse_string (node, ",", &str);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  *names = g_strsplit (str, ",", -1);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to parse the node in the graph.
+ * The input nodes should be defined before the node, so the nodes are in topological order.
+ */
+static int
+_ml_extension_graph_node_parse (ml_extension_graph_s * graph,
+    JsonObject * object, guint index)
+{
+  ml_extension_graph_node_s *node, *prev;
+  ml_option_h option = NULL;
+  const gchar *name;
+  gchar **names = NULL;
+  guint i, count, n_tensors = 0;
+  int status = ML_ERROR_NONE;
+
+  name = _ml_service_get_json_string_member (object, "name");
+  if (!STR_IS_VALID (name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, the node in the graph should have valid name.");
+  }
+
+  if (_ml_extension_graph_node_find (graph, name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot add duplicated node '%s' in the graph.",
+        name);
+  }
+
+  node = g_try_new0 (ml_extension_graph_node_s, 1);
+  if (!node) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate new memory for the node in the graph. Out of memory?");
+  }
+
+  node->name = g_strdup (name);
+  node->index = index;
+  node->inputs = g_ptr_array_new ();
+  node->outputs = g_ptr_array_new ();
+  g_ptr_array_add (graph->nodes, node);
+
+  if (json_object_has_member (object, "input")) {
+    status = _ml_extension_graph_parse_names (json_object_get_member (object,
+            "input"), &names);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report
+          ("Failed to parse configuration file, cannot parse the input of node '%s'.",
+          name);
+      goto done;
+    }
+
+    for (i = 0; names[i]; i++) {
+      prev = _ml_extension_graph_node_find (graph, names[i]);
+
+      if (!prev || prev == node) {
+        status = ML_ERROR_INVALID_PARAMETER;
+        _ml_error_report
+            ("Failed to parse configuration file, cannot find the input node '%s', it should be defined before the node '%s'.",
+            names[i], name);
+        goto done;
+      }
+
+      g_ptr_array_add (node->inputs, prev);
+      g_ptr_array_add (prev->outputs, node);
+    }
+  }
+
+  status = ml_option_create (&option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot create ml-option handle.");
+    goto done;
+  }
+
+  status = _ml_service_extension_conf_parse_single_option (object, option,
+      NULL, NULL);
+  if (status == ML_ERROR_NONE)
+    status = ml_single_open_with_option (&node->single, option);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot open the model of node '%s'.",
+        name);
+    goto done;
+  }
+
+  ml_single_get_input_info (node->single, &node->in_info);
+  ml_single_get_output_info (node->single, &node->out_info);
+
+  /* The output tensors of input nodes are linked to the input of this node. */
+  if (node->inputs->len > 0) {
+    for (i = 0; i < node->inputs->len; i++) {
+      prev = g_ptr_array_index (node->inputs, i);
+
+      count = 0U;
+      ml_tensors_info_get_count (prev->out_info, &count);
+      n_tensors += count;
+    }
+
+    count = 0U;
+    ml_tensors_info_get_count (node->in_info, &count);
+
+    if (count != n_tensors) {
+      status = ML_ERROR_INVALID_PARAMETER;
+      _ml_error_report
+          ("Failed to parse configuration file, the number of input tensors of node '%s' (%u) is different from the output of input nodes (%u).",
+          name, count, n_tensors);
+    }
+  }
+
+done:
+  if (option)
+    ml_option_destroy (option);
+  g_strfreev (names);
+  return status;
+}
+
+/**
+ * @brief Internal function to get the input data of the node.
+ * The output buffers of input nodes are linked to the input data without copying.
+ */
+static int
+_ml_extension_graph_node_get_input (ml_extension_graph_s * graph,
+    ml_extension_graph_node_s * node, ml_tensors_data_h * input)
+{
+  ml_extension_graph_node_s *prev;
+  ml_tensors_data_s *_in, *_prev;
+  guint i, j, n = 0;
+  int status;
+
+  if (node->inputs->len == 0) {
+    *input = graph->input;
+    return ML_ERROR_NONE;
+  }
+
+  status = _ml_tensors_data_create_no_alloc (node->in_info, input);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  _in = (ml_tensors_data_s *) (*input);
+
+  for (i = 0; i < node->inputs->len; i++) {
+    prev = g_ptr_array_index (node->inputs, i);
+    _prev = (ml_tensors_data_s *) graph->results[prev->index];
+
+    for (j = 0; j < _prev->num_tensors && n < _in->num_tensors; j++, n++) {
+      _in->tensors[n].data = _prev->tensors[j].data;
+      _in->tensors[n].size = _prev->tensors[j].size;
+    }
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to run the node in worker thread.
+ */
+static void
+_ml_extension_graph_node_run (gpointer data, gpointer user_data)
+{
+  ml_extension_graph_node_s *node = (ml_extension_graph_node_s *) data;
+  ml_extension_graph_s *graph = (ml_extension_graph_s *) user_data;
+  ml_tensors_data_h input = NULL;
+  ml_tensors_data_h output = NULL;
+  guint i;
+  int status;
+
+  g_mutex_lock (&graph->lock);
+  status = graph->status;
+  g_mutex_unlock (&graph->lock);
+
+  /* Skip invoking the model if other node is failed. */
+  if (status == ML_ERROR_NONE) {
+    status = _ml_extension_graph_node_get_input (graph, node, &input);
+
+    if (status == ML_ERROR_NONE)
+      status = ml_single_invoke (node->single, input, &output);
+
+    /* Do not release the buffers, these are the output of other nodes. */
+    if (input && input != graph->input)
+      _ml_tensors_data_destroy_internal (input, FALSE);
+
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report ("Failed to invoke the model of node '%s' in the graph.",
+          node->name);
+    }
+  }
+
+  g_mutex_lock (&graph->lock);
+  graph->results[node->index] = output;
+  if (status != ML_ERROR_NONE && graph->status == ML_ERROR_NONE)
+    graph->status = status;
+
+  for (i = 0; i < node->outputs->len; i++) {
+    ml_extension_graph_node_s *next = g_ptr_array_index (node->outputs, i);
+
+    if (--graph->pending[next->index] == 0)
+      g_thread_pool_push (graph->pool, next, NULL);
+  }
+
+  graph->remaining--;
+  if (graph->remaining == 0)
+    g_cond_signal (&graph->cond);
+  g_mutex_unlock (&graph->lock);
+}
+
+/**
+ * @brief Internal function to fetch the activated models of the nodes into the cache.
+ */
+static void
+_ml_extension_graph_prefetch_models (JsonArray * array)
+{
+  g_autoptr (GPtrArray) keys = g_ptr_array_new ();
+  JsonObject *object;
+  const gchar *key;
+  guint i, n;
+
+  n = json_array_get_length (array);
+  for (i = 0; i < n; i++) {
+    object = json_array_get_object_element (array, i);
+    key = object ? _ml_service_get_json_string_member (object, "key") : NULL;
+
+    if (STR_IS_VALID (key))
+      g_ptr_array_add (keys, (gpointer) key);
+  }
+
+  /* Ignore the error here, the node reports the model it cannot get. */
+  if (keys->len > 1)
+    _ml_service_model_cache_prefetch ((const char **) keys->pdata, keys->len);
+}
+
+/**
+ * @brief Internal function to create the graph of single-shot models from json.
+ */
+int
+_ml_service_extension_graph_create (ml_service_s * mls, JsonObject * object,
+    ml_extension_graph_s ** graph)
+{
+  ml_extension_graph_s *g;
+  ml_extension_graph_node_s *node;
+  JsonArray *array = NULL;
+  gchar **names = NULL;
+  g_autoptr (GError) err = NULL;
+  guint i, n = 0, workers;
+  int status = ML_ERROR_NONE;
+
+  if (json_object_has_member (object, "nodes"))
+    array = json_object_get_array_member (object, "nodes");
+  if (array)
+    n = json_array_get_length (array);
+
+  if (n == 0) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot find the nodes of the graph.");
+  }
+
+  g = g_try_new0 (ml_extension_graph_s, 1);
+  if (!g) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the graph in ml-service extension. Out of memory?");
+  }
+
+  g->mls = mls;
+  g->nodes = g_ptr_array_new_with_free_func (_ml_extension_graph_node_free);
+  g_mutex_init (&g->lock);
+  g_cond_init (&g->cond);
+
+  /* Fetch the activated models of all nodes at once, instead of the request for each node. */
+  _ml_extension_graph_prefetch_models (array);
+
+  for (i = 0; i < n; i++) {
+    status = _ml_extension_graph_node_parse (g,
+        json_array_get_object_element (array, i), i);
+    if (status != ML_ERROR_NONE)
+      goto error;
+  }
+
+  /**
+   * "output" : the nodes to invoke new-data event.
+   * If it is not defined, the nodes without consumer are the output of the graph.
+   */
+  if (json_object_has_member (object, "output")) {
+    status = _ml_extension_graph_parse_names (json_object_get_member (object,
+            "output"), &names);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report
+          ("Failed to parse configuration file, cannot parse the output of the graph.");
+      goto error;
+    }
+
+    for (i = 0; names[i]; i++) {
+      node = _ml_extension_graph_node_find (g, names[i]);
+
+      if (!node) {
+        status = ML_ERROR_INVALID_PARAMETER;
+        _ml_error_report
+            ("Failed to parse configuration file, cannot find the output node '%s'.",
+            names[i]);
+        goto error;
+      }
+
+      node->is_output = TRUE;
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      node = g_ptr_array_index (g->nodes, i);
+      node->is_output = (node->outputs->len == 0);
+    }
+  }
+
+  workers = MIN (n, g_get_num_processors ());
+  if (json_object_has_member (object, "workers")) {
+    gint64 val = json_object_get_int_member (object, "workers");
+
+    if (val < 1 || val > G_MAXINT) {
+      status = ML_ERROR_INVALID_PARAMETER;
+      _ml_error_report
+          ("Failed to parse configuration file, the number of workers (%"
+          G_GINT64_FORMAT ") should be a positive number.", val);
+      goto error;
+    }
+
+    workers = (guint) val;
+  }
+
+  g->pool = g_thread_pool_new (_ml_extension_graph_node_run, g, (gint) workers,
+      FALSE, &err);
+  if (!g->pool) {
+    status = ML_ERROR_OUT_OF_MEMORY;
+    _ml_error_report ("Failed to create the worker pool of the graph: %s",
+        err ? err->message : "Unknown error");
+    goto error;
+  }
+
+  g->results = g_new0 (ml_tensors_data_h, n);
+  g->pending = g_new0 (guint, n);
+
+error:
+  g_strfreev (names);
+
+  if (status == ML_ERROR_NONE)
+    *graph = g;
+  else
+    _ml_service_extension_graph_destroy (g);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to release the graph of single-shot models.
+ */
+void
+_ml_service_extension_graph_destroy (ml_extension_graph_s * graph)
+{
+  if (!graph)
+    return;
+
+  if (graph->pool) {
+    g_thread_pool_free (graph->pool, TRUE, TRUE);
+    graph->pool = NULL;
+  }
+
+  if (graph->nodes) {
+    g_ptr_array_free (graph->nodes, TRUE);
+    graph->nodes = NULL;
+  }
+
+  g_free (graph->results);
+  g_free (graph->pending);
+  g_mutex_clear (&graph->lock);
+  g_cond_clear (&graph->cond);
+  g_free (graph);
+}
+
+/**
+ * @brief Internal function to process the input data with the graph and invoke new-data event for each output node.
+ */
+int
+_ml_service_extension_graph_invoke (ml_extension_graph_s * graph,
+    const ml_tensors_data_h input)
+{
+  ml_extension_graph_node_s *node;
+  guint i;
+  int status;
+
+  g_mutex_lock (&graph->lock);
+
+  graph->input = input;
+  graph->status = ML_ERROR_NONE;
+  graph->remaining = graph->nodes->len;
+
+  for (i = 0; i < graph->nodes->len; i++) {
+    node = g_ptr_array_index (graph->nodes, i);
+
+    graph->pending[i] = node->inputs->len;
+    graph->results[i] = NULL;
+  }
+
+  /* Start the nodes which take the input of the graph. */
+  for (i = 0; i < graph->nodes->len; i++) {
+    node = g_ptr_array_index (graph->nodes, i);
+
+    if (node->inputs->len == 0)
+      g_thread_pool_push (graph->pool, node, NULL);
+  }
+
+  while (graph->remaining > 0)
+    g_cond_wait (&graph->cond, &graph->lock);
+
+  status = graph->status;
+  graph->input = NULL;
+
+  g_mutex_unlock (&graph->lock);
+
+  for (i = 0; i < graph->nodes->len; i++) {
+    node = g_ptr_array_index (graph->nodes, i);
+
+    if (status == ML_ERROR_NONE && node->is_output)
+      _ml_service_invoke_event_new_data (graph->mls, node->name,
+          graph->results[i]);
+
+    if (graph->results[i]) {
+      ml_tensors_data_destroy (graph->results[i]);
+      graph->results[i] = NULL;
+    }
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int
+_ml_service_extension_graph_get_input_information (ml_extension_graph_s *
+    graph, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_graph_node_s *node = NULL;
+  guint i;
+
+  if (STR_IS_VALID (name)) {
+    node = _ml_extension_graph_node_find (graph, name);
+  } else {
+    /* Find the first node which takes the input of the graph. */
+    for (i = 0; i < graph->nodes->len; i++) {
+      node = g_ptr_array_index (graph->nodes, i);
+
+      if (node->inputs->len == 0)
+        break;
+    }
+  }
+
+  if (!node || node->inputs->len > 0)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (node->in_info, info);
+}
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int
+_ml_service_extension_graph_get_output_information (ml_extension_graph_s *
+    graph, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_graph_node_s *node = NULL;
+  guint i;
+
+  if (STR_IS_VALID (name)) {
+    node = _ml_extension_graph_node_find (graph, name);
+  } else {
+    /* Find the first output node. */
+    for (i = 0; i < graph->nodes->len; i++) {
+      node = g_ptr_array_index (graph->nodes, i);
+
+      if (node->is_output)
+        break;
+    }
+  }
+
+  if (!node || !node->is_output)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (node->out_info, info);
+}
@@ -0,0 +1,55 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-graph.h
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, graph of single-shot models.
+ *              This file should NOT be exported to SDK or devel package.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+#ifndef __ML_API_SERVICE_EXTENSION_GRAPH_H__
+#define __ML_API_SERVICE_EXTENSION_GRAPH_H__
+
+#include "ml-api-service-private.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Internal structure for the graph of single-shot models in ml-service extension.
+ */
+typedef struct _ml_extension_graph_s ml_extension_graph_s;
+
+/**
+ * @brief Internal function to create the graph of single-shot models from json.
+ */
+int _ml_service_extension_graph_create (ml_service_s *mls, JsonObject *object, ml_extension_graph_s **graph);
+
+/**
+ * @brief Internal function to release the graph of single-shot models.
+ */
+void _ml_service_extension_graph_destroy (ml_extension_graph_s *graph);
+
+/**
+ * @brief Internal function to process the input data with the graph and invoke new-data event for each output node.
+ */
+int _ml_service_extension_graph_invoke (ml_extension_graph_s *graph, const ml_tensors_data_h input);
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int _ml_service_extension_graph_get_input_information (ml_extension_graph_s *graph, const char *name, ml_tensors_info_h *info);
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int _ml_service_extension_graph_get_output_information (ml_extension_graph_s *graph, const char *name, ml_tensors_info_h *info);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __ML_API_SERVICE_EXTENSION_GRAPH_H__ */
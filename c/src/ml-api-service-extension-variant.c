@@ -0,0 +1,614 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-variant.c
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, load-adaptive variants of single-shot model.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+
+#include "ml-api-service-extension.h"
+#include "ml-api-service-extension-variant.h"
+
+/**
+ * @brief The default ratio of the SLO to switch back to the preferred variant.
+ */
+#define DEFAULT_RECOVER_RATIO (0.5)
+
+/**
+ * @brief The default time to keep the variant before switching back to the preferred variant, in millisecond.
+ */
+#define DEFAULT_HOLD_TIME (1000)
+
+/**
+ * @brief Internal structure of the variant of the model.
+ */
+typedef struct
+{
+  gchar *name;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_info_h out_info;
+
+  gint64 latency; /**< The moving average of the invoke latency, in microseconds. */
+  gint64 base_latency; /**< The latency measured at creation, in microseconds. */
+  guint64 requests; /**< The number of requests processed with this variant. */
+  gint64 active_time; /**< The time this variant has been selected, in microseconds. */
+} ml_extension_variant_model_s;
+
+/**
+ * @brief Internal structure for the load-adaptive variants of single-shot model.
+ */
+struct _ml_extension_variant_s
+{
+  ml_service_s *mls;
+  GPtrArray *models; /**< The variants in order of preference, the last one is the cheapest. */
+
+  /**
+   * The SLO (0 to disable each condition).
+   * - max_depth : The max number of requests waiting in message queue.
+   * - max_latency : The max expected latency of the request (invoke latency x (queue depth + 1)), in microseconds.
+   */
+  guint max_depth;
+  gint64 max_latency;
+
+  /**
+   * Hysteresis to prevent switching the variants back and forth.
+   * ml-service switches back to the preferred variant when the load is under the SLO x ratio, and the current variant is kept for the hold time.
+   */
+  gdouble ratio;
+  gint64 hold;
+  gint64 window; /**< The interval to check the load, in microseconds (0 to check for each request). */
+
+  GMutex lock;
+  guint current;
+  gint64 since; /**< The time when the current variant is selected. */
+  gint64 checked; /**< The time when the load is checked. */
+  guint64 switches;
+};
+
+/**
+ * @brief Internal function to release the variant of the model.
+ */
+static void
+_ml_extension_variant_model_free (gpointer data)
+{
+  ml_extension_variant_model_s *model = (ml_extension_variant_model_s *) data;
+
+  if (!model)
+    return;
+
+  if (model->single)
+    ml_single_close (model->single);
+  if (model->in_info)
+    ml_tensors_info_destroy (model->in_info);
+  if (model->out_info)
+    ml_tensors_info_destroy (model->out_info);
+
+  g_free (model->name);
+  g_free (model);
+}
+
+/**
+ * @brief Internal function to find the variant with the name or index.
+ */
+static ml_extension_variant_model_s *
+_ml_extension_variant_model_find (ml_extension_variant_s * variant,
+    const gchar * name)
+{
+  ml_extension_variant_model_s *model;
+  gchar *endptr = NULL;
+  guint64 index;
+  guint i;
+
+  if (!STR_IS_VALID (name))
+    return NULL;
+
+  for (i = 0; i < variant->models->len; i++) {
+    model = g_ptr_array_index (variant->models, i);
+
+    if (g_ascii_strcasecmp (model->name, name) == 0)
+      return model;
+  }
+
+  index = g_ascii_strtoull (name, &endptr, 10);
+  if (endptr != name && *endptr == '\0' && index < variant->models->len)
+    return g_ptr_array_index (variant->models, index);
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to measure the invoke latency of the variant with zero-filled input data.
+ * The first invoke warms up the model, and the second one gives the initial latency.
+ */
+static void
+_ml_extension_variant_model_measure (ml_extension_variant_model_s * model)
+{
+  ml_tensors_data_h input = NULL;
+  ml_tensors_data_h output = NULL;
+  gint64 start;
+  guint i;
+  int status;
+
+  status = ml_tensors_data_create (model->in_info, &input);
+
+  for (i = 0; i < 2 && status == ML_ERROR_NONE; i++) {
+    start = g_get_monotonic_time ();
+    status = ml_single_invoke (model->single, input, &output);
+
+    if (status == ML_ERROR_NONE) {
+      model->latency = g_get_monotonic_time () - start;
+      ml_tensors_data_destroy (output);
+      output = NULL;
+    }
+  }
+
+  if (status != ML_ERROR_NONE)
+    _ml_logw ("Failed to measure the latency of the variant '%s'.",
+        model->name);
+
+  model->base_latency = model->latency;
+
+  if (input)
+    ml_tensors_data_destroy (input);
+}
+
+/**
+ * @brief Internal function to parse the variant of the model.
+ */
+static int
+_ml_extension_variant_model_parse (ml_extension_variant_s * variant,
+    JsonObject * object)
+{
+  ml_extension_variant_model_s *model, *first;
+  ml_option_h option = NULL;
+  const gchar *name;
+  int status;
+
+  /* The name of the variant is the model key if it is not defined. */
+  name = _ml_service_get_json_string_member (object, "name");
+  if (!STR_IS_VALID (name))
+    name = _ml_service_get_json_string_member (object, "key");
+
+  if (!STR_IS_VALID (name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, the variant should have valid name.");
+  }
+
+  if (_ml_extension_variant_model_find (variant, name)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot add duplicated variant '%s'.",
+        name);
+  }
+
+  model = g_try_new0 (ml_extension_variant_model_s, 1);
+  if (!model) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate new memory for the variant. Out of memory?");
+  }
+
+  model->name = g_strdup (name);
+  g_ptr_array_add (variant->models, model);
+
+  status = ml_option_create (&option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot create ml-option handle.");
+    goto done;
+  }
+
+  status = _ml_service_extension_conf_parse_single_option (object, option,
+      NULL, NULL);
+  if (status == ML_ERROR_NONE)
+    status = ml_single_open_with_option (&model->single, option);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to parse configuration file, cannot open the model of variant '%s'.",
+        name);
+    goto done;
+  }
+
+  ml_single_get_input_info (model->single, &model->in_info);
+  ml_single_get_output_info (model->single, &model->out_info);
+
+  /* The request can be processed with any variant. */
+  first = g_ptr_array_index (variant->models, 0);
+  if (first != model && !ml_tensors_info_is_equal (first->in_info,
+          model->in_info)) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    _ml_error_report
+        ("Failed to parse configuration file, the input of variant '%s' is different from the variant '%s'.",
+        name, first->name);
+    goto done;
+  }
+
+  _ml_extension_variant_model_measure (model);
+
+done:
+  if (option)
+    ml_option_destroy (option);
+  return status;
+}
+
+/**
+ * @brief Internal function to fetch the activated models of the variants into the cache.
+ */
+static void
+_ml_extension_variant_prefetch_models (JsonArray * array)
+{
+  g_autoptr (GPtrArray) keys = g_ptr_array_new ();
+  JsonObject *object;
+  const gchar *key;
+  guint i, n;
+
+  n = json_array_get_length (array);
+  for (i = 0; i < n; i++) {
+    object = json_array_get_object_element (array, i);
+    key = object ? _ml_service_get_json_string_member (object, "key") : NULL;
+
+    if (STR_IS_VALID (key))
+      g_ptr_array_add (keys, (gpointer) key);
+  }
+
+  /* Ignore the error here, the variant reports the model it cannot get. */
+  if (keys->len > 1)
+    _ml_service_model_cache_prefetch ((const char **) keys->pdata, keys->len);
+}
+
+/**
+ * @brief Internal function to check the expected latency of the variant meets the SLO x ratio.
+ */
+static gboolean
+_ml_extension_variant_meets_latency (ml_extension_variant_s * variant,
+    ml_extension_variant_model_s * model, guint depth, gdouble ratio)
+{
+  return (variant->max_latency == 0 ||
+      model->latency * (depth + 1) <= variant->max_latency * ratio);
+}
+
+/**
+ * @brief Internal function to select the variant with the load. This should be called with lock.
+ * If the load exceeds the SLO, ml-service switches to the most preferred cheaper variant whose expected latency meets the SLO (or the cheapest one).
+ * If the load is under the SLO x ratio, ml-service switches back to the most preferred variant whose expected latency meets the SLO x ratio.
+ */
+static void
+_ml_extension_variant_select (ml_extension_variant_s * variant, guint depth,
+    gint64 now)
+{
+  ml_extension_variant_model_s *model, *other;
+  guint i, next;
+  gboolean overloaded;
+
+  if (variant->window > 0 && now - variant->checked < variant->window)
+    return;
+
+  variant->checked = now;
+  next = variant->current;
+  model = g_ptr_array_index (variant->models, variant->current);
+
+  overloaded = (variant->max_depth > 0 && depth > variant->max_depth) ||
+      !_ml_extension_variant_meets_latency (variant, model, depth, 1.0);
+
+  if (overloaded) {
+    for (i = variant->current + 1; i < variant->models->len; i++) {
+      other = g_ptr_array_index (variant->models, i);
+      next = i;
+
+      if (_ml_extension_variant_meets_latency (variant, other, depth, 1.0))
+        break;
+    }
+  } else if (variant->current > 0 && now - variant->since >= variant->hold &&
+      (variant->max_depth == 0 ||
+          depth <= variant->max_depth * variant->ratio)) {
+    for (i = 0; i < variant->current; i++) {
+      other = g_ptr_array_index (variant->models, i);
+
+      /**
+       * The latency of the inactive variant is not updated, and it may be measured under the overload.
+       * Decay it to the latency measured at creation, so that it can be selected again.
+       */
+      other->latency -= (other->latency - other->base_latency) / 8;
+
+      if (_ml_extension_variant_meets_latency (variant, other, depth,
+              variant->ratio)) {
+        next = i;
+        break;
+      }
+    }
+  }
+
+  if (next != variant->current) {
+    model->active_time += now - variant->since;
+    variant->since = now;
+    variant->current = next;
+    variant->switches++;
+
+    _ml_logi ("Switch the variant from '%s' to '%s' (queue depth %u).",
+        model->name,
+        ((ml_extension_variant_model_s *) g_ptr_array_index (variant->models,
+                next))->name, depth);
+  }
+}
+
+/**
+ * @brief Internal function to create the variants of single-shot model from json.
+ */
+int
+_ml_service_extension_variant_create (ml_service_s * mls, JsonObject * object,
+    ml_extension_variant_s ** variant)
+{
+  ml_extension_variant_s *v;
+  JsonArray *array = NULL;
+  JsonObject *member;
+  gint64 depth;
+  guint i, n = 0;
+  int status = ML_ERROR_NONE;
+
+  if (json_object_has_member (object, "models"))
+    array = json_object_get_array_member (object, "models");
+  if (array)
+    n = json_array_get_length (array);
+
+  if (n == 0) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse configuration file, cannot find the models of the variants.");
+  }
+
+  v = g_try_new0 (ml_extension_variant_s, 1);
+  if (!v) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the variants in ml-service extension. Out of memory?");
+  }
+
+  v->mls = mls;
+  v->models = g_ptr_array_new_with_free_func (_ml_extension_variant_model_free);
+  v->ratio = DEFAULT_RECOVER_RATIO;
+  v->hold = DEFAULT_HOLD_TIME * G_TIME_SPAN_MILLISECOND;
+  g_mutex_init (&v->lock);
+
+  /**
+   * "slo" : queue_depth (the number of waiting requests) and latency (millisecond).
+   * "hysteresis" : ratio (0 ~ 1) of the SLO and hold time (millisecond) to switch back to the preferred variant.
+   * "window" : the interval to check the load (millisecond).
+   */
+  if (json_object_has_member (object, "slo")) {
+    member = json_object_get_object_member (object, "slo");
+
+    if (member && json_object_has_member (member, "queue_depth")) {
+      depth = json_object_get_int_member (member, "queue_depth");
+      if (depth < 0 || depth > G_MAXUINT) {
+        status = ML_ERROR_INVALID_PARAMETER;
+        _ml_error_report
+            ("Failed to parse configuration file, invalid queue depth (%"
+            G_GINT64_FORMAT ") of the SLO.", depth);
+        goto error;
+      }
+
+      v->max_depth = (guint) depth;
+    }
+
+    if (member && json_object_has_member (member, "latency")) {
+      v->max_latency = json_object_get_int_member (member, "latency") *
+          G_TIME_SPAN_MILLISECOND;
+      if (v->max_latency < 0) {
+        status = ML_ERROR_INVALID_PARAMETER;
+        _ml_error_report
+            ("Failed to parse configuration file, the latency of the SLO should not be negative.");
+        goto error;
+      }
+    }
+  }
+
+  if (json_object_has_member (object, "hysteresis")) {
+    member = json_object_get_object_member (object, "hysteresis");
+
+    if (member && json_object_has_member (member, "ratio"))
+      v->ratio = json_object_get_double_member (member, "ratio");
+    if (member && json_object_has_member (member, "hold"))
+      v->hold = json_object_get_int_member (member, "hold") *
+          G_TIME_SPAN_MILLISECOND;
+  }
+
+  if (json_object_has_member (object, "window"))
+    v->window = json_object_get_int_member (object, "window") *
+        G_TIME_SPAN_MILLISECOND;
+
+  if (v->max_depth == 0 && v->max_latency == 0) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    _ml_error_report
+        ("Failed to parse configuration file, the variants should have the SLO of queue depth or latency.");
+    goto error;
+  }
+
+  if (v->ratio <= 0.0 || v->ratio > 1.0 || v->hold < 0 || v->window < 0) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    _ml_error_report
+        ("Failed to parse configuration file, invalid hysteresis (ratio %.2f, hold %"
+        G_GINT64_FORMAT " ms) or time window (%" G_GINT64_FORMAT
+        " ms) of the variants.", v->ratio, v->hold / G_TIME_SPAN_MILLISECOND,
+        v->window / G_TIME_SPAN_MILLISECOND);
+    goto error;
+  }
+
+  /* Fetch the activated models of all variants at once, instead of the request for each variant. */
+  _ml_extension_variant_prefetch_models (array);
+
+  for (i = 0; i < n; i++) {
+    status = _ml_extension_variant_model_parse (v,
+        json_array_get_object_element (array, i));
+    if (status != ML_ERROR_NONE)
+      goto error;
+  }
+
+  v->since = v->checked = g_get_monotonic_time ();
+
+error:
+  if (status == ML_ERROR_NONE)
+    *variant = v;
+  else
+    _ml_service_extension_variant_destroy (v);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to release the variants of single-shot model.
+ */
+void
+_ml_service_extension_variant_destroy (ml_extension_variant_s * variant)
+{
+  if (!variant)
+    return;
+
+  if (variant->models) {
+    g_ptr_array_free (variant->models, TRUE);
+    variant->models = NULL;
+  }
+
+  g_mutex_clear (&variant->lock);
+  g_free (variant);
+}
+
+/**
+ * @brief Internal function to select the variant with given queue depth, and invoke new-data event with the output of the variant.
+ */
+int
+_ml_service_extension_variant_invoke (ml_extension_variant_s * variant,
+    const ml_tensors_data_h input, guint depth)
+{
+  ml_extension_variant_model_s *model;
+  ml_tensors_data_h output = NULL;
+  gint64 start, latency;
+  int status;
+
+  start = g_get_monotonic_time ();
+
+  g_mutex_lock (&variant->lock);
+  _ml_extension_variant_select (variant, depth, start);
+  model = g_ptr_array_index (variant->models, variant->current);
+  g_mutex_unlock (&variant->lock);
+
+  status = ml_single_invoke (model->single, input, &output);
+  latency = g_get_monotonic_time () - start;
+
+  g_mutex_lock (&variant->lock);
+  model->requests++;
+  if (status == ML_ERROR_NONE)
+    model->latency += (latency - model->latency) / 8;
+  g_mutex_unlock (&variant->lock);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to invoke the model of variant '%s'.", model->name);
+  }
+
+  _ml_service_invoke_event_new_data (variant->mls, model->name, output);
+  ml_tensors_data_destroy (output);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int
+_ml_service_extension_variant_get_input_information (ml_extension_variant_s *
+    variant, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_variant_model_s *model;
+
+  /* All variants take the same input, the name is optional. */
+  if (STR_IS_VALID (name))
+    model = _ml_extension_variant_model_find (variant, name);
+  else
+    model = g_ptr_array_index (variant->models, 0);
+
+  if (!model)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (model->in_info, info);
+}
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int
+_ml_service_extension_variant_get_output_information (ml_extension_variant_s *
+    variant, const char *name, ml_tensors_info_h * info)
+{
+  ml_extension_variant_model_s *model;
+
+  /* The current variant gives the output if the name is not given. */
+  if (STR_IS_VALID (name)) {
+    model = _ml_extension_variant_model_find (variant, name);
+  } else {
+    g_mutex_lock (&variant->lock);
+    model = g_ptr_array_index (variant->models, variant->current);
+    g_mutex_unlock (&variant->lock);
+  }
+
+  if (!model)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  return _ml_tensors_info_create_from (model->out_info, info);
+}
+
+/**
+ * @brief Internal function to get the statistics of the variants.
+ * (variant_current, variant_switches, variant_time_<name or index>, variant_requests_<name or index>, variant_latency_<name or index>)
+ */
+int
+_ml_service_extension_variant_get_information (ml_extension_variant_s *
+    variant, const char *name, gchar ** value)
+{
+  ml_extension_variant_model_s *model, *current;
+  const gchar *key = NULL;
+  gchar *val = NULL;
+  gint64 active_time;
+
+  g_mutex_lock (&variant->lock);
+  current = g_ptr_array_index (variant->models, variant->current);
+
+  if (g_ascii_strcasecmp (name, "variant_current") == 0) {
+    val = g_strdup (current->name);
+  } else if (g_ascii_strcasecmp (name, "variant_switches") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, variant->switches);
+  } else if (g_str_has_prefix (name, "variant_time_")) {
+    key = name + strlen ("variant_time_");
+    model = _ml_extension_variant_model_find (variant, key);
+
+    if (model) {
+      /* Add the time of current variant until now, in millisecond. */
+      active_time = model->active_time;
+      if (model == current)
+        active_time += g_get_monotonic_time () - variant->since;
+
+      val = g_strdup_printf ("%" G_GINT64_FORMAT,
+          active_time / G_TIME_SPAN_MILLISECOND);
+    }
+  } else if (g_str_has_prefix (name, "variant_requests_")) {
+    key = name + strlen ("variant_requests_");
+    model = _ml_extension_variant_model_find (variant, key);
+
+    if (model)
+      val = g_strdup_printf ("%" G_GUINT64_FORMAT, model->requests);
+  } else if (g_str_has_prefix (name, "variant_latency_")) {
+    key = name + strlen ("variant_latency_");
+    model = _ml_extension_variant_model_find (variant, key);
+
+    if (model)
+      val = g_strdup_printf ("%" G_GINT64_FORMAT, model->latency);
+  }
+  g_mutex_unlock (&variant->lock);
+
+  if (!val)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  *value = val;
+  return ML_ERROR_NONE;
+}
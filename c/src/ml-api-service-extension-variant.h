@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @file        ml-api-service-extension-variant.h
+ * @date        19 October 2026
+ * @brief       ML service extension C-API, load-adaptive variants of single-shot model.
+ *              This file should NOT be exported to SDK or devel package.
+ * @see         https://github.com/nnstreamer/api
+ * @author      agent <agent@local>
+ * @bug         No known bugs except for NYI items
+ */
+#ifndef __ML_API_SERVICE_EXTENSION_VARIANT_H__
+#define __ML_API_SERVICE_EXTENSION_VARIANT_H__
+
+#include "ml-api-service-private.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief Internal structure for the load-adaptive variants of single-shot model in ml-service extension.
+ */
+typedef struct _ml_extension_variant_s ml_extension_variant_s;
+
+/**
+ * @brief Internal function to create the variants of single-shot model from json.
+ */
+int _ml_service_extension_variant_create (ml_service_s *mls, JsonObject *object, ml_extension_variant_s **variant);
+
+/**
+ * @brief Internal function to release the variants of single-shot model.
+ */
+void _ml_service_extension_variant_destroy (ml_extension_variant_s *variant);
+
+/**
+ * @brief Internal function to select the variant with given queue depth, and invoke new-data event with the output of the variant.
+ */
+int _ml_service_extension_variant_invoke (ml_extension_variant_s *variant, const ml_tensors_data_h input, guint depth);
+
+/**
+ * @brief Internal function to get the information of required input data.
+ */
+int _ml_service_extension_variant_get_input_information (ml_extension_variant_s *variant, const char *name, ml_tensors_info_h *info);
+
+/**
+ * @brief Internal function to get the information of output data.
+ */
+int _ml_service_extension_variant_get_output_information (ml_extension_variant_s *variant, const char *name, ml_tensors_info_h *info);
+
+/**
+ * @brief Internal function to get the statistics of the variants.
+ */
+int _ml_service_extension_variant_get_information (ml_extension_variant_s *variant, const char *name, gchar **value);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __ML_API_SERVICE_EXTENSION_VARIANT_H__ */
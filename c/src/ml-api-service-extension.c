@@ -10,7 +10,12 @@
  * @bug         No known bugs except for NYI items
  */
 
+#include <nnstreamer-tizen-internal.h>
+
 #include "ml-api-service-extension.h"
+#include "ml-api-service-extension-graph.h"
+#include "ml-api-service-extension-cascade.h"
+#include "ml-api-service-extension-variant.h"
 
 /**
  * @brief The time to wait for new input data in message thread, in millisecond.
@@ -30,6 +35,9 @@ typedef enum
   ML_EXTENSION_TYPE_UNKNOWN = 0,
   ML_EXTENSION_TYPE_SINGLE = 1,
   ML_EXTENSION_TYPE_PIPELINE = 2,
+  ML_EXTENSION_TYPE_GRAPH = 3,
+  ML_EXTENSION_TYPE_CASCADE = 4,
+  ML_EXTENSION_TYPE_VARIANT = 5,
 
   ML_EXTENSION_TYPE_MAX
 } ml_extension_type_e;
@@ -42,8 +50,36 @@ typedef struct
   gchar *name;
   ml_tensors_data_h input;
   ml_tensors_data_h output;
+  ml_service_request_priority_e priority;
+  guint64 seq; /**< The sequence number to keep the order of the requests with same priority and deadline. */
+  gint64 queued; /**< The monotonic time when the request is queued, in microseconds. */
+  gint64 deadline; /**< The monotonic time to drop the request, in microseconds (0 for no deadline). */
 } ml_extension_msg_s;
 
+/**
+ * @brief Internal structure of the statistics for each request priority.
+ */
+typedef struct
+{
+  guint depth; /**< The number of requests in message queue. */
+  guint64 processed; /**< The number of processed requests. */
+  guint64 dropped; /**< The number of requests dropped because the deadline has passed. */
+  gint64 latency_total; /**< Total latency of the processed requests, in microseconds. */
+  gint64 latency_max; /**< Max latency of the processed requests, in microseconds. */
+} ml_extension_priority_stat_s;
+
+/**
+ * @brief Internal structure of the cached result in ml-service extension handle.
+ */
+typedef struct
+{
+  guint64 hash;
+  gsize size; /**< The size of input and output data. */
+  ml_tensors_data_h input;
+  ml_tensors_data_h output;
+  GList *link; /**< The link in LRU list. */
+} ml_extension_cache_entry_s;
+
 /**
  * @brief Internal structure for ml-service extension handle.
  */
@@ -55,16 +91,66 @@ typedef struct
   guint max_input; /**< The max number of input data in message queue (see DEFAULT_MAX_INPUT). */
   GThread *msg_thread;
   GAsyncQueue *msg_queue;
+  guint64 msg_seq;
+
+  /**
+   * Scheduling attributes of the message thread and the streaming threads of the pipeline.
+   * The models of single-shot, graph, cascade and variants are invoked in the message thread.
+   */
+  ml_thread_attr_s thread_attr;
+  ml_option_h thread_option;
+  int thread_status; /**< The result of applying the attributes in message thread. */
+
+  GMutex stat_lock;
+  ml_extension_priority_stat_s stat[ML_SERVICE_REQUEST_PRIORITY_MAX];
 
   /**
    * Handles for each ml-service extension type.
    * - single : Default. Open model file and prepare invoke. The configuration should include model information.
    * - pipeline : Construct a pipeline from configuration. The configuration should include pipeline description.
+   * - graph : Open several models and run these with the data flow between the models. The configuration should include the nodes of the graph.
+   * - cascade : Open several models and run these in order until the result of the model is confident. The configuration should include the stages of the cascade.
+   * - variant : Open several variants of the model and switch to the cheaper variant when the load exceeds the SLO. The configuration should include the variants and the SLO.
    */
   ml_single_h single;
+  GMutex single_lock;
+  GCond single_cond;
+  ml_single_h single_in_use; /**< The single-shot handle which is invoking in message thread. */
+
+  /**
+   * Model hot-swap for the key-based single-shot extension.
+   * The reload thread checks the activated model of the key and swaps the single-shot handle in background.
+   */
+  gchar *model_key;
+  gchar *model_path;
+  JsonObject *single_conf; /**< The configuration of single-shot to open the activated model. */
+  GThread *reload_thread;
+  GMutex reload_lock;
+  GCond reload_cond;
+  gboolean reload_running;
+  gboolean reload_requested;
+  guint reload_interval; /**< The interval to check the activated model, in millisecond (0 to disable). */
+
+  /**
+   * LRU result cache for the single-shot extension (disabled if max_bytes is 0).
+   * The cache is used for the deterministic model, the same input always gives the same output.
+   */
+  GMutex cache_lock;
+  GHashTable *cache_table;
+  GQueue cache_lru; /**< The most recently used entry is at the head. */
+  gsize cache_max_bytes;
+  gsize cache_bytes;
+  guint64 cache_hit;
+  guint64 cache_miss;
+  guint64 cache_eviction;
+  guint cache_generation; /**< Increased when the cache is cleared, the result of the old model is not kept. */
 
   ml_pipeline_h pipeline;
   GHashTable *node_table;
+
+  ml_extension_graph_s *graph;
+  ml_extension_cascade_s *cascade;
+  ml_extension_variant_s *variant;
 } ml_extension_s;
 
 /**
@@ -152,6 +238,559 @@ _ml_extension_msg_free (gpointer data)
   g_free (msg);
 }
 
+/**
+ * @brief Internal function to compare the messages, higher priority and earlier deadline comes first.
+ */
+static gint
+_ml_extension_msg_compare (gconstpointer a, gconstpointer b, gpointer user_data)
+{
+  const ml_extension_msg_s *msg1 = (const ml_extension_msg_s *) a;
+  const ml_extension_msg_s *msg2 = (const ml_extension_msg_s *) b;
+
+  if (msg1->priority != msg2->priority)
+    return (msg1->priority > msg2->priority) ? -1 : 1;
+
+  if (msg1->deadline != msg2->deadline) {
+    /* The request without deadline comes after the request with deadline. */
+    if (msg1->deadline == 0)
+      return 1;
+    if (msg2->deadline == 0)
+      return -1;
+
+    return (msg1->deadline < msg2->deadline) ? -1 : 1;
+  }
+
+  return (msg1->seq < msg2->seq) ? -1 : 1;
+}
+
+/**
+ * @brief Internal function to get the name of request priority.
+ */
+static const gchar *
+_ml_extension_priority_get_name (ml_service_request_priority_e priority)
+{
+  switch (priority) {
+    case ML_SERVICE_REQUEST_PRIORITY_LOW:
+      return "low";
+    case ML_SERVICE_REQUEST_PRIORITY_NORMAL:
+      return "normal";
+    case ML_SERVICE_REQUEST_PRIORITY_HIGH:
+      return "high";
+    default:
+      break;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to update the statistics when the message is dequeued.
+ */
+static void
+_ml_extension_stat_update (ml_extension_s * ext, ml_extension_msg_s * msg,
+    gboolean dropped)
+{
+  ml_extension_priority_stat_s *stat = &ext->stat[msg->priority];
+  gint64 latency;
+
+  g_mutex_lock (&ext->stat_lock);
+
+  if (stat->depth > 0)
+    stat->depth--;
+
+  if (dropped) {
+    stat->dropped++;
+  } else {
+    latency = g_get_monotonic_time () - msg->queued;
+
+    stat->processed++;
+    stat->latency_total += latency;
+    if (stat->latency_max < latency)
+      stat->latency_max = latency;
+  }
+
+  g_mutex_unlock (&ext->stat_lock);
+}
+
+/**
+ * @brief Internal function to drop the queued request of the lowest priority to push new request of higher priority.
+ * @return TRUE if a request is dropped.
+ */
+static gboolean
+_ml_extension_msg_evict (ml_extension_s * ext,
+    ml_service_request_priority_e priority)
+{
+  ml_extension_msg_s *msg, *victim = NULL;
+  GSList *list = NULL, *l;
+
+  g_async_queue_lock (ext->msg_queue);
+
+  /* The queue is sorted, the last message has the lowest priority and the latest deadline. */
+  while ((msg = g_async_queue_try_pop_unlocked (ext->msg_queue)) != NULL)
+    list = g_slist_prepend (list, msg);
+
+  if (list && ((ml_extension_msg_s *) list->data)->priority < priority) {
+    victim = (ml_extension_msg_s *) list->data;
+    list = g_slist_delete_link (list, list);
+  }
+
+  for (l = list; l; l = l->next)
+    g_async_queue_push_sorted_unlocked (ext->msg_queue, l->data,
+        _ml_extension_msg_compare, NULL);
+
+  g_async_queue_unlock (ext->msg_queue);
+  g_slist_free (list);
+
+  if (!victim)
+    return FALSE;
+
+  _ml_logw
+      ("The queue is full, drop the request of %s priority to push new request.",
+      _ml_extension_priority_get_name (victim->priority));
+  _ml_extension_stat_update (ext, victim, TRUE);
+  _ml_extension_msg_free (victim);
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to rotate 64-bit value for the cache hash.
+ */
+#define ML_EXTENSION_ROTL64(x,r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+/**
+ * @brief Primes for the cache hash (same as xxHash64).
+ */
+#define ML_EXTENSION_PRIME64_1 G_GUINT64_CONSTANT (0x9E3779B185EBCA87)
+#define ML_EXTENSION_PRIME64_2 G_GUINT64_CONSTANT (0xC2B2AE3D27D4EB4F)
+#define ML_EXTENSION_PRIME64_3 G_GUINT64_CONSTANT (0x165667B19E3779F9)
+
+/**
+ * @brief Internal function to hash the buffer.
+ * Four independent lanes are processed in the main loop, so that the compiler can vectorize it.
+ */
+static guint64
+_ml_extension_cache_hash_buffer (guint64 seed, const guint8 * buf, gsize len)
+{
+  guint64 acc[4];
+  guint64 lane, h;
+  gsize i = 0;
+  guint j;
+
+  acc[0] = seed + ML_EXTENSION_PRIME64_1 + ML_EXTENSION_PRIME64_2;
+  acc[1] = seed + ML_EXTENSION_PRIME64_2;
+  acc[2] = seed;
+  acc[3] = seed - ML_EXTENSION_PRIME64_1;
+
+  for (; i + 32 <= len; i += 32) {
+    for (j = 0; j < 4; j++) {
+      memcpy (&lane, buf + i + j * 8, sizeof (lane));
+      acc[j] += lane * ML_EXTENSION_PRIME64_2;
+      acc[j] = ML_EXTENSION_ROTL64 (acc[j], 31) * ML_EXTENSION_PRIME64_1;
+    }
+  }
+
+  h = ML_EXTENSION_ROTL64 (acc[0], 1) + ML_EXTENSION_ROTL64 (acc[1], 7) +
+      ML_EXTENSION_ROTL64 (acc[2], 12) + ML_EXTENSION_ROTL64 (acc[3], 18);
+  h += (guint64) len;
+
+  for (; i < len; i++) {
+    h ^= buf[i] * ML_EXTENSION_PRIME64_3;
+    h = ML_EXTENSION_ROTL64 (h, 11) * ML_EXTENSION_PRIME64_1;
+  }
+
+  h ^= h >> 33;
+  h *= ML_EXTENSION_PRIME64_2;
+  h ^= h >> 29;
+  h *= ML_EXTENSION_PRIME64_3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+/**
+ * @brief Internal function to hash the tensors data.
+ */
+static guint64
+_ml_extension_cache_hash (const ml_tensors_data_h data)
+{
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  guint64 hash = (guint64) _data->num_tensors;
+  guint i;
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    hash = _ml_extension_cache_hash_buffer (hash,
+        (const guint8 *) _data->tensors[i].data, _data->tensors[i].size);
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Internal function to get the size of tensors data.
+ */
+static gsize
+_ml_extension_cache_data_size (const ml_tensors_data_h data)
+{
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  gsize size = 0;
+  guint i;
+
+  for (i = 0; i < _data->num_tensors; i++)
+    size += _data->tensors[i].size;
+
+  return size;
+}
+
+/**
+ * @brief Internal function to compare the tensors data.
+ */
+static gboolean
+_ml_extension_cache_data_equal (const ml_tensors_data_h data1,
+    const ml_tensors_data_h data2)
+{
+  ml_tensors_data_s *_data1 = (ml_tensors_data_s *) data1;
+  ml_tensors_data_s *_data2 = (ml_tensors_data_s *) data2;
+  guint i;
+
+  if (_data1->num_tensors != _data2->num_tensors)
+    return FALSE;
+
+  for (i = 0; i < _data1->num_tensors; i++) {
+    if (_data1->tensors[i].size != _data2->tensors[i].size)
+      return FALSE;
+
+    if (memcmp (_data1->tensors[i].data, _data2->tensors[i].data,
+            _data1->tensors[i].size) != 0)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to release the cached result.
+ */
+static void
+_ml_extension_cache_entry_free (gpointer data)
+{
+  ml_extension_cache_entry_s *entry = (ml_extension_cache_entry_s *) data;
+
+  if (!entry)
+    return;
+
+  if (entry->input)
+    ml_tensors_data_destroy (entry->input);
+  if (entry->output)
+    ml_tensors_data_destroy (entry->output);
+
+  g_free (entry);
+}
+
+/**
+ * @brief Internal function to remove the cached result. Caller should hold the cache lock.
+ */
+static void
+_ml_extension_cache_remove (ml_extension_s * ext,
+    ml_extension_cache_entry_s * entry)
+{
+  g_queue_delete_link (&ext->cache_lru, entry->link);
+  ext->cache_bytes -= entry->size;
+
+  /* The hash table releases the entry. */
+  g_hash_table_remove (ext->cache_table, &entry->hash);
+}
+
+/**
+ * @brief Internal function to clear the cached results, e.g., the model is changed.
+ */
+static void
+_ml_extension_cache_clear (ml_extension_s * ext)
+{
+  if (!ext->cache_table)
+    return;
+
+  g_mutex_lock (&ext->cache_lock);
+  g_queue_clear (&ext->cache_lru);
+  g_hash_table_remove_all (ext->cache_table);
+  ext->cache_bytes = 0;
+  ext->cache_generation++;
+  g_mutex_unlock (&ext->cache_lock);
+}
+
+/**
+ * @brief Internal function to find the cached result of the input.
+ * If found, invoke new-data event with cached output and return TRUE.
+ * The generation of the cache is returned to add the result after invoking the model.
+ */
+static gboolean
+_ml_extension_cache_lookup (ml_service_s * mls, ml_extension_msg_s * msg,
+    guint64 hash, guint * generation)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  ml_extension_cache_entry_s *entry;
+  ml_tensors_data_h output = NULL;
+
+  g_mutex_lock (&ext->cache_lock);
+  *generation = ext->cache_generation;
+  entry = g_hash_table_lookup (ext->cache_table, &hash);
+
+  if (entry && _ml_extension_cache_data_equal (entry->input, msg->input)) {
+    /* Move to the head of LRU list. */
+    g_queue_unlink (&ext->cache_lru, entry->link);
+    g_queue_push_head_link (&ext->cache_lru, entry->link);
+
+    /* The entry may be evicted after unlock, invoke the event with copied data. */
+    if (ml_tensors_data_clone (entry->output, &output) != ML_ERROR_NONE)
+      output = NULL;
+
+    ext->cache_hit++;
+  } else {
+    ext->cache_miss++;
+  }
+  g_mutex_unlock (&ext->cache_lock);
+
+  if (!output)
+    return FALSE;
+
+  msg->output = output;
+  _ml_service_invoke_event_new_data (mls, NULL, msg->output);
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to add the result into the cache.
+ * The input and output data in the message are moved into the cache.
+ * The result is not added if the cache is cleared after the lookup, e.g., the model is changed while invoking.
+ */
+static void
+_ml_extension_cache_insert (ml_extension_s * ext, ml_extension_msg_s * msg,
+    guint64 hash, guint generation)
+{
+  ml_extension_cache_entry_s *entry;
+  gsize size;
+
+  size = _ml_extension_cache_data_size (msg->input) +
+      _ml_extension_cache_data_size (msg->output);
+
+  /* Too large to keep the result. */
+  if (size > ext->cache_max_bytes)
+    return;
+
+  entry = g_try_new0 (ml_extension_cache_entry_s, 1);
+  if (!entry)
+    return;
+
+  entry->hash = hash;
+  entry->size = size;
+  entry->input = msg->input;
+  entry->output = msg->output;
+  msg->input = msg->output = NULL;
+
+  g_mutex_lock (&ext->cache_lock);
+
+  if (generation != ext->cache_generation) {
+    g_mutex_unlock (&ext->cache_lock);
+
+    msg->input = entry->input;
+    msg->output = entry->output;
+    g_free (entry);
+    return;
+  }
+
+  /* Replace the entry if hash is collided. */
+  if (g_hash_table_contains (ext->cache_table, &hash))
+    _ml_extension_cache_remove (ext, g_hash_table_lookup (ext->cache_table,
+            &hash));
+
+  while (ext->cache_bytes + size > ext->cache_max_bytes &&
+      !g_queue_is_empty (&ext->cache_lru)) {
+    _ml_extension_cache_remove (ext, g_queue_peek_tail (&ext->cache_lru));
+    ext->cache_eviction++;
+  }
+
+  g_queue_push_head (&ext->cache_lru, entry);
+  entry->link = g_queue_peek_head_link (&ext->cache_lru);
+  ext->cache_bytes += size;
+  g_hash_table_insert (ext->cache_table, &entry->hash, entry);
+
+  g_mutex_unlock (&ext->cache_lock);
+}
+
+/**
+ * @brief Internal function to get the single-shot handle to invoke the model in message thread.
+ */
+static ml_single_h
+_ml_extension_single_get (ml_extension_s * ext)
+{
+  ml_single_h single;
+
+  g_mutex_lock (&ext->single_lock);
+  single = ext->single_in_use = ext->single;
+  g_mutex_unlock (&ext->single_lock);
+
+  return single;
+}
+
+/**
+ * @brief Internal function to release the single-shot handle after invoking the model.
+ */
+static void
+_ml_extension_single_release (ml_extension_s * ext)
+{
+  g_mutex_lock (&ext->single_lock);
+  ext->single_in_use = NULL;
+  g_cond_broadcast (&ext->single_cond);
+  g_mutex_unlock (&ext->single_lock);
+}
+
+/**
+ * @brief Internal function to warm up the model with zero-filled input data.
+ */
+static void
+_ml_extension_single_warmup (ml_single_h single)
+{
+  ml_tensors_info_h info = NULL;
+  ml_tensors_data_h input = NULL;
+  ml_tensors_data_h output = NULL;
+  int status;
+
+  status = ml_single_get_input_info (single, &info);
+  if (status == ML_ERROR_NONE)
+    status = ml_tensors_data_create (info, &input);
+
+  if (status == ML_ERROR_NONE)
+    status = ml_single_invoke (single, input, &output);
+
+  if (status != ML_ERROR_NONE)
+    _ml_logw ("Failed to warm up the model, the first request may be delayed.");
+
+  if (info)
+    ml_tensors_info_destroy (info);
+  if (input)
+    ml_tensors_data_destroy (input);
+  if (output)
+    ml_tensors_data_destroy (output);
+}
+
+/**
+ * @brief Internal function to open the activated model of the key and swap the single-shot handle.
+ * The old handle is closed after the message thread finishes the current request.
+ */
+static int
+_ml_extension_single_reload (ml_service_s * mls)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  ml_option_h option = NULL;
+  ml_single_h single = NULL;
+  ml_single_h old_single;
+  gchar *paths = NULL;
+  void *value;
+  int status;
+
+  /* Get the activated model from ml-service agent, the model may be changed in other process. */
+  _ml_service_model_cache_invalidate (ext->model_key);
+
+  status = ml_option_create (&option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to reload the model, cannot create ml-option handle.");
+  }
+
+  /* Set the activated model in new option, the loaded model is not changed until new model is opened. */
+  status = _ml_service_extension_conf_parse_single_option (ext->single_conf,
+      option, NULL, &paths);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to reload the model, cannot get the activated model of '%s'.",
+        ext->model_key);
+    goto done;
+  }
+
+  if (!STR_IS_VALID (paths) || g_strcmp0 (paths, ext->model_path) == 0) {
+    /* The activated model is not changed. */
+    goto done;
+  }
+
+  status = ml_single_open_with_option (&single, option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report
+        ("Failed to reload the model, cannot open the activated model of '%s'.",
+        ext->model_key);
+    goto done;
+  }
+
+  /* The single-shot already warmed up the model if the option has warmup count. */
+  if (ml_option_get (option, "warmup", &value) != ML_ERROR_NONE)
+    _ml_extension_single_warmup (single);
+
+  g_mutex_lock (&ext->single_lock);
+  old_single = ext->single;
+
+  /**
+   * The cached results are from the old model.
+   * Clear the cache before the new model is visible, the result of the old model which is invoking now is not added.
+   */
+  _ml_extension_cache_clear (ext);
+  ext->single = single;
+
+  g_free (ext->model_path);
+  ext->model_path = paths;
+  paths = NULL;
+
+  /* Wait until the message thread releases the old handle. */
+  while (old_single && ext->single_in_use == old_single)
+    g_cond_wait (&ext->single_cond, &ext->single_lock);
+  g_mutex_unlock (&ext->single_lock);
+
+  if (old_single)
+    ml_single_close (old_single);
+
+  _ml_logi ("The model of '%s' is reloaded in ml-service extension.",
+      ext->model_key);
+
+done:
+  g_free (paths);
+  ml_option_destroy (option);
+  return status;
+}
+
+/**
+ * @brief Internal function to check the activated model and reload it in background.
+ */
+static gpointer
+_ml_extension_reload_thread (gpointer data)
+{
+  ml_service_s *mls = (ml_service_s *) data;
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  gint64 end_time;
+
+  g_mutex_lock (&ext->reload_lock);
+  while (ext->reload_running) {
+    if (!ext->reload_requested) {
+      if (ext->reload_interval > 0) {
+        end_time = g_get_monotonic_time () +
+            ext->reload_interval * G_TIME_SPAN_MILLISECOND;
+        g_cond_wait_until (&ext->reload_cond, &ext->reload_lock, end_time);
+      } else {
+        g_cond_wait (&ext->reload_cond, &ext->reload_lock);
+      }
+    }
+
+    if (!ext->reload_running)
+      break;
+
+    ext->reload_requested = FALSE;
+    g_mutex_unlock (&ext->reload_lock);
+
+    _ml_extension_single_reload (mls);
+
+    g_mutex_lock (&ext->reload_lock);
+  }
+  g_mutex_unlock (&ext->reload_lock);
+
+  return NULL;
+}
+
 /**
  * @brief Internal function to process ml-service extension message.
  */
@@ -163,7 +802,9 @@ _ml_extension_msg_thread (gpointer data)
   int status;
 
   g_mutex_lock (&mls->lock);
-  ext->running = TRUE;
+  if (_ml_thread_attr_is_set (&ext->thread_attr))
+    ext->thread_status = _ml_thread_attr_apply (&ext->thread_attr, 0, NULL);
+  ext->running = (ext->thread_status == ML_ERROR_NONE);
   g_cond_signal (&mls->cond);
   g_mutex_unlock (&mls->lock);
 
@@ -174,17 +815,43 @@ _ml_extension_msg_thread (gpointer data)
         ext->timeout * G_TIME_SPAN_MILLISECOND);
 
     if (msg) {
+      if (msg->deadline > 0 && msg->deadline < g_get_monotonic_time ()) {
+        _ml_logw
+            ("The deadline of the request has passed, drop the request in ml-service extension thread.");
+        _ml_extension_stat_update (ext, msg, TRUE);
+        _ml_extension_msg_free (msg);
+        continue;
+      }
+
       switch (ext->type) {
         case ML_EXTENSION_TYPE_SINGLE:
         {
-          status = ml_single_invoke (ext->single, msg->input, &msg->output);
+          ml_single_h single;
+          guint64 hash = 0;
+          guint generation = 0;
+
+          if (ext->cache_table) {
+            hash = _ml_extension_cache_hash (msg->input);
+
+            if (_ml_extension_cache_lookup (mls, msg, hash, &generation))
+              break;
+          }
+
+          single = _ml_extension_single_get (ext);
+          status = ml_single_invoke (single, msg->input, &msg->output);
 
           if (status == ML_ERROR_NONE) {
             _ml_service_invoke_event_new_data (mls, NULL, msg->output);
+
+            /* The result is not added if the model is changed after the lookup. */
+            if (ext->cache_table)
+              _ml_extension_cache_insert (ext, msg, hash, generation);
           } else {
             _ml_error_report
                 ("Failed to invoke the model in ml-service extension thread.");
           }
+
+          _ml_extension_single_release (ext);
           break;
         }
         case ML_EXTENSION_TYPE_PIPELINE:
@@ -210,11 +877,40 @@ _ml_extension_msg_thread (gpointer data)
           }
           break;
         }
+        case ML_EXTENSION_TYPE_GRAPH:
+          status = _ml_service_extension_graph_invoke (ext->graph, msg->input);
+          if (status != ML_ERROR_NONE) {
+            _ml_error_report
+                ("Failed to process the graph in ml-service extension thread.");
+          }
+          break;
+        case ML_EXTENSION_TYPE_CASCADE:
+          status = _ml_service_extension_cascade_invoke (ext->cascade,
+              msg->input);
+          if (status != ML_ERROR_NONE) {
+            _ml_error_report
+                ("Failed to process the cascade in ml-service extension thread.");
+          }
+          break;
+        case ML_EXTENSION_TYPE_VARIANT:
+        {
+          gint depth = g_async_queue_length (ext->msg_queue);
+
+          /* Select the variant with the number of requests waiting in the queue. */
+          status = _ml_service_extension_variant_invoke (ext->variant,
+              msg->input, (guint) MAX (depth, 0));
+          if (status != ML_ERROR_NONE) {
+            _ml_error_report
+                ("Failed to invoke the variant of the model in ml-service extension thread.");
+          }
+          break;
+        }
         default:
           /* Unknown ml-service extension type, skip this. */
           break;
       }
 
+      _ml_extension_stat_update (ext, msg, FALSE);
       _ml_extension_msg_free (msg);
     }
   }
@@ -235,20 +931,13 @@ _ml_extension_destroy_tensors_info (void *data)
 }
 
 /**
- * @brief Internal function to parse single-shot info from json.
+ * @brief Internal function to parse single-shot info from json and set the option to open the model.
  */
-static int
-_ml_extension_conf_parse_single (ml_service_s * mls, JsonObject * single)
+int
+_ml_service_extension_conf_parse_single_option (JsonObject * single,
+    ml_option_h option, gchar ** model_key, gchar ** model_path)
 {
-  ml_extension_s *ext = (ml_extension_s *) mls->priv;
-  ml_option_h option;
-  int status;
-
-  status = ml_option_create (&option);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_return (status,
-        "Failed to parse configuration file, cannot create ml-option handle.");
-  }
+  int status = ML_ERROR_NONE;
 
   /**
    * 1. "key" : load model info from ml-service agent.
@@ -268,6 +957,12 @@ _ml_extension_conf_parse_single (ml_service_s * mls, JsonObject * single)
         ml_information_get (model_info, "path", (void **) (&paths));
         ml_option_set (option, "models", g_strdup (paths), g_free);
 
+        /* Keep the key and path to reload the model when the activated model is changed. */
+        if (model_key)
+          *model_key = g_strdup (key);
+        if (model_path)
+          *model_path = g_strdup (paths);
+
         ml_information_destroy (model_info);
       } else {
         _ml_error_report
@@ -339,11 +1034,50 @@ _ml_extension_conf_parse_single (ml_service_s * mls, JsonObject * single)
       ml_option_set (option, "custom", g_strdup (custom), g_free);
   }
 
+  if (json_object_has_member (single, "warmup")) {
+    JsonNode *warmup_node = json_object_get_member (single, "warmup");
+
+    if (JSON_NODE_HOLDS_VALUE (warmup_node) &&
+        json_node_get_value_type (warmup_node) == G_TYPE_STRING) {
+      ml_option_set (option, "warmup",
+          g_strdup (json_node_get_string (warmup_node)), g_free);
+    } else if (JSON_NODE_HOLDS_VALUE (warmup_node)) {
+      ml_option_set (option, "warmup", g_strdup_printf ("%" G_GINT64_FORMAT,
+              json_node_get_int (warmup_node)), g_free);
+    }
+  }
+
 error:
+  return status;
+}
+
+/**
+ * @brief Internal function to parse single-shot info from json.
+ */
+static int
+_ml_extension_conf_parse_single (ml_service_s * mls, JsonObject * single)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  ml_option_h option;
+  int status;
+
+  status = ml_option_create (&option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to parse configuration file, cannot create ml-option handle.");
+  }
+
+  status = _ml_service_extension_conf_parse_single_option (single, option,
+      &ext->model_key, &ext->model_path);
   if (status == ML_ERROR_NONE)
     status = ml_single_open_with_option (&ext->single, option);
 
+  /* Keep the configuration to open the activated model when reloading the model. */
+  if (status == ML_ERROR_NONE && ext->model_key)
+    ext->single_conf = json_object_ref (single);
+
   ml_option_destroy (option);
+
   return status;
 }
 
@@ -458,6 +1192,14 @@ _ml_extension_conf_parse_pipeline (ml_service_s * mls, JsonObject * pipe)
         "Failed to parse configuration file, cannot construct the pipeline.");
   }
 
+  if (ext->thread_option) {
+    status = ml_pipeline_set_thread_option (ext->pipeline, ext->thread_option);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_return (status,
+          "Failed to parse configuration file, cannot set the scheduling attributes of the pipeline.");
+    }
+  }
+
   if (json_object_has_member (pipe, "input_node")) {
     JsonNode *node = json_object_get_member (pipe, "input_node");
 
@@ -495,6 +1237,56 @@ _ml_extension_conf_parse_pipeline (ml_service_s * mls, JsonObject * pipe)
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to parse the scheduling attributes of the threads from json.
+ */
+static int
+_ml_extension_conf_parse_thread (ml_service_s * mls, JsonObject * thread)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  GList *members, *l;
+  int status;
+
+  status = ml_option_create (&ext->thread_option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to parse configuration file, cannot create ml-option handle.");
+  }
+
+  /* The value may be an integer or a string, the attributes are set with string value. */
+  members = json_object_get_members (thread);
+  for (l = members; l; l = g_list_next (l)) {
+    const gchar *key = (const gchar *) l->data;
+    JsonNode *node = json_object_get_member (thread, key);
+    GType type = JSON_NODE_HOLDS_VALUE (node) ?
+        json_node_get_value_type (node) : G_TYPE_INVALID;
+    gchar *value;
+
+    if (type == G_TYPE_STRING) {
+      value = g_strdup (json_node_get_string (node));
+    } else if (type == G_TYPE_INT64) {
+      value = g_strdup_printf ("%" G_GINT64_FORMAT, json_node_get_int (node));
+    } else {
+      g_list_free (members);
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to parse configuration file, the value of '%s' in thread should be an integer or a string.",
+          key);
+    }
+
+    ml_option_set (ext->thread_option, key, value, g_free);
+  }
+  g_list_free (members);
+
+  status = _ml_thread_attr_set_from_option (&ext->thread_attr,
+      ext->thread_option);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to parse configuration file, cannot get the scheduling attributes of the thread.");
+  }
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Internal function to parse configuration file.
  */
@@ -504,6 +1296,21 @@ _ml_extension_conf_parse_json (ml_service_s * mls, JsonObject * object)
   ml_extension_s *ext = (ml_extension_s *) mls->priv;
   int status;
 
+  /* "thread" : scheduling attributes of the threads in ml-service, parse it first to apply it to the pipeline. */
+  if (json_object_has_member (object, "thread")) {
+    JsonObject *thread;
+
+    if (!JSON_NODE_HOLDS_OBJECT (json_object_get_member (object, "thread"))) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "Failed to parse configuration file, 'thread' should be an object.");
+    }
+
+    thread = json_object_get_object_member (object, "thread");
+    status = _ml_extension_conf_parse_thread (mls, thread);
+    if (status != ML_ERROR_NONE)
+      return status;
+  }
+
   if (json_object_has_member (object, "single")) {
     JsonObject *single = json_object_get_object_member (object, "single");
 
@@ -512,6 +1319,28 @@ _ml_extension_conf_parse_json (ml_service_s * mls, JsonObject * object)
       return status;
 
     ext->type = ML_EXTENSION_TYPE_SINGLE;
+
+    /* "cache" : keep the results of the deterministic model. */
+    if (json_object_has_member (object, "cache")) {
+      JsonObject *cache = json_object_get_object_member (object, "cache");
+
+      if (cache && json_object_has_member (cache, "max_bytes")) {
+        gint64 max_bytes = json_object_get_int_member (cache, "max_bytes");
+
+        if (max_bytes < 0) {
+          _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+              "Failed to parse configuration file, the max bytes of the cache (%"
+              G_GINT64_FORMAT ") should not be negative.", max_bytes);
+        }
+
+        ext->cache_max_bytes = (gsize) max_bytes;
+      }
+
+      if (ext->cache_max_bytes > 0) {
+        ext->cache_table = g_hash_table_new_full (g_int64_hash,
+            g_int64_equal, NULL, _ml_extension_cache_entry_free);
+      }
+    }
   } else if (json_object_has_member (object, "pipeline")) {
     JsonObject *pipe = json_object_get_object_member (object, "pipeline");
 
@@ -520,6 +1349,32 @@ _ml_extension_conf_parse_json (ml_service_s * mls, JsonObject * object)
       return status;
 
     ext->type = ML_EXTENSION_TYPE_PIPELINE;
+  } else if (json_object_has_member (object, "graph")) {
+    JsonObject *graph = json_object_get_object_member (object, "graph");
+
+    status = _ml_service_extension_graph_create (mls, graph, &ext->graph);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    ext->type = ML_EXTENSION_TYPE_GRAPH;
+  } else if (json_object_has_member (object, "cascade")) {
+    JsonObject *cascade = json_object_get_object_member (object, "cascade");
+
+    status = _ml_service_extension_cascade_create (mls, cascade,
+        &ext->cascade);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    ext->type = ML_EXTENSION_TYPE_CASCADE;
+  } else if (json_object_has_member (object, "variants")) {
+    JsonObject *variants = json_object_get_object_member (object, "variants");
+
+    status = _ml_service_extension_variant_create (mls, variants,
+        &ext->variant);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    ext->type = ML_EXTENSION_TYPE_VARIANT;
   } else {
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "Failed to parse configuration file, cannot get the valid type from configuration.");
@@ -550,6 +1405,13 @@ _ml_service_extension_create (ml_service_s * mls, JsonObject * object)
   ext->max_input = DEFAULT_MAX_INPUT;
   ext->node_table = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
       _ml_extension_node_info_free);
+  g_mutex_init (&ext->stat_lock);
+  g_mutex_init (&ext->single_lock);
+  g_cond_init (&ext->single_cond);
+  g_mutex_init (&ext->reload_lock);
+  g_cond_init (&ext->reload_cond);
+  g_mutex_init (&ext->cache_lock);
+  g_queue_init (&ext->cache_lru);
 
   status = _ml_extension_conf_parse_json (mls, object);
   if (status != ML_ERROR_NONE) {
@@ -564,8 +1426,23 @@ _ml_service_extension_create (ml_service_s * mls, JsonObject * object)
 
   /* Wait until the message thread has been initialized. */
   g_cond_wait (&mls->cond, &mls->lock);
+  status = ext->thread_status;
   g_mutex_unlock (&mls->lock);
 
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_return (status,
+        "Failed to apply the scheduling attributes to the message thread of ml-service extension.");
+  }
+
+  if (ext->model_key) {
+    g_autofree gchar *reload_name =
+        g_strdup_printf ("ml-ext-reload-%d", getpid ());
+
+    ext->reload_running = TRUE;
+    ext->reload_thread = g_thread_new (reload_name,
+        _ml_extension_reload_thread, mls);
+  }
+
   return ML_ERROR_NONE;
 }
 
@@ -581,6 +1458,17 @@ _ml_service_extension_destroy (ml_service_s * mls)
   if (!ext)
     return ML_ERROR_NONE;
 
+  /* Close reload thread first, it may swap the single-shot handle. */
+  if (ext->reload_thread) {
+    g_mutex_lock (&ext->reload_lock);
+    ext->reload_running = FALSE;
+    g_cond_signal (&ext->reload_cond);
+    g_mutex_unlock (&ext->reload_lock);
+
+    g_thread_join (ext->reload_thread);
+    ext->reload_thread = NULL;
+  }
+
   /**
    * Close message thread.
    * If model inference is running, it may wait for the result in message thread.
@@ -613,6 +1501,47 @@ _ml_service_extension_destroy (ml_service_s * mls)
     ext->node_table = NULL;
   }
 
+  if (ext->graph) {
+    _ml_service_extension_graph_destroy (ext->graph);
+    ext->graph = NULL;
+  }
+
+  if (ext->cascade) {
+    _ml_service_extension_cascade_destroy (ext->cascade);
+    ext->cascade = NULL;
+  }
+
+  if (ext->variant) {
+    _ml_service_extension_variant_destroy (ext->variant);
+    ext->variant = NULL;
+  }
+
+  if (ext->single_conf) {
+    json_object_unref (ext->single_conf);
+    ext->single_conf = NULL;
+  }
+
+  if (ext->thread_option) {
+    ml_option_destroy (ext->thread_option);
+    ext->thread_option = NULL;
+  }
+  _ml_thread_attr_clear (&ext->thread_attr);
+
+  if (ext->cache_table) {
+    _ml_extension_cache_clear (ext);
+    g_hash_table_destroy (ext->cache_table);
+    ext->cache_table = NULL;
+  }
+
+  g_free (ext->model_key);
+  g_free (ext->model_path);
+
+  g_mutex_clear (&ext->stat_lock);
+  g_mutex_clear (&ext->single_lock);
+  g_cond_clear (&ext->single_cond);
+  g_mutex_clear (&ext->reload_lock);
+  g_cond_clear (&ext->reload_cond);
+  g_mutex_clear (&ext->cache_lock);
   g_free (ext);
   mls->priv = NULL;
 
@@ -633,6 +1562,9 @@ _ml_service_extension_start (ml_service_s * mls)
       status = ml_pipeline_start (ext->pipeline);
       break;
     case ML_EXTENSION_TYPE_SINGLE:
+    case ML_EXTENSION_TYPE_GRAPH:
+    case ML_EXTENSION_TYPE_CASCADE:
+    case ML_EXTENSION_TYPE_VARIANT:
       /* Do nothing. */
       break;
     default:
@@ -657,6 +1589,9 @@ _ml_service_extension_stop (ml_service_s * mls)
       status = ml_pipeline_stop (ext->pipeline);
       break;
     case ML_EXTENSION_TYPE_SINGLE:
+    case ML_EXTENSION_TYPE_GRAPH:
+    case ML_EXTENSION_TYPE_CASCADE:
+    case ML_EXTENSION_TYPE_VARIANT:
       /* Do nothing. */
       break;
     default:
@@ -679,7 +1614,21 @@ _ml_service_extension_get_input_information (ml_service_s * mls,
 
   switch (ext->type) {
     case ML_EXTENSION_TYPE_SINGLE:
+      g_mutex_lock (&ext->single_lock);
       status = ml_single_get_input_info (ext->single, info);
+      g_mutex_unlock (&ext->single_lock);
+      break;
+    case ML_EXTENSION_TYPE_GRAPH:
+      status = _ml_service_extension_graph_get_input_information (ext->graph,
+          name, info);
+      break;
+    case ML_EXTENSION_TYPE_CASCADE:
+      status = _ml_service_extension_cascade_get_input_information
+          (ext->cascade, name, info);
+      break;
+    case ML_EXTENSION_TYPE_VARIANT:
+      status = _ml_service_extension_variant_get_input_information
+          (ext->variant, name, info);
       break;
     case ML_EXTENSION_TYPE_PIPELINE:
     {
@@ -714,7 +1663,21 @@ _ml_service_extension_get_output_information (ml_service_s * mls,
 
   switch (ext->type) {
     case ML_EXTENSION_TYPE_SINGLE:
+      g_mutex_lock (&ext->single_lock);
       status = ml_single_get_output_info (ext->single, info);
+      g_mutex_unlock (&ext->single_lock);
+      break;
+    case ML_EXTENSION_TYPE_GRAPH:
+      status = _ml_service_extension_graph_get_output_information (ext->graph,
+          name, info);
+      break;
+    case ML_EXTENSION_TYPE_CASCADE:
+      status = _ml_service_extension_cascade_get_output_information
+          (ext->cascade, name, info);
+      break;
+    case ML_EXTENSION_TYPE_VARIANT:
+      status = _ml_service_extension_variant_get_output_information
+          (ext->variant, name, info);
       break;
     case ML_EXTENSION_TYPE_PIPELINE:
     {
@@ -759,17 +1722,140 @@ _ml_service_extension_set_information (ml_service_s * mls, const char *name,
     ext->max_input = (guint) g_ascii_strtoull (value, NULL, 10);
   } else if (g_ascii_strcasecmp (name, "timeout") == 0) {
     ext->timeout = (guint) g_ascii_strtoull (value, NULL, 10);
+  } else if (g_ascii_strcasecmp (name, "reload_interval") == 0) {
+    g_mutex_lock (&ext->reload_lock);
+    ext->reload_interval = (guint) g_ascii_strtoull (value, NULL, 10);
+    g_cond_signal (&ext->reload_cond);
+    g_mutex_unlock (&ext->reload_lock);
   }
 
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to request to reload the activated model in ml-service extension.
+ */
+int
+_ml_service_extension_reload (ml_service_s * mls)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+
+  if (ext->type != ML_EXTENSION_TYPE_SINGLE || !ext->reload_thread) {
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "Cannot reload the model, ml-service extension should be configured with the model key.");
+  }
+
+  g_mutex_lock (&ext->reload_lock);
+  ext->reload_requested = TRUE;
+  g_cond_signal (&ext->reload_cond);
+  g_mutex_unlock (&ext->reload_lock);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to get the information of ml-service extension.
+ */
+int
+_ml_service_extension_get_information (ml_service_s * mls, const char *name,
+    gchar ** value)
+{
+  ml_extension_s *ext = (ml_extension_s *) mls->priv;
+  ml_extension_priority_stat_s *stat;
+  g_autofree gchar *prefix = NULL;
+  const gchar *pos;
+  gchar *val = NULL;
+  gint i;
+
+  /* The path of the loaded model, it is changed when the activated model is reloaded. */
+  if (ext->model_key && g_ascii_strcasecmp (name, "model_path") == 0) {
+    g_mutex_lock (&ext->single_lock);
+    val = g_strdup (ext->model_path);
+    g_mutex_unlock (&ext->single_lock);
+
+    if (!val)
+      return ML_ERROR_INVALID_PARAMETER;
+
+    *value = val;
+    return ML_ERROR_NONE;
+  }
+
+  /* The statistics of the result cache. */
+  if (ext->cache_table && g_str_has_prefix (name, "cache_")) {
+    g_mutex_lock (&ext->cache_lock);
+    if (g_ascii_strcasecmp (name, "cache_hit") == 0)
+      val = g_strdup_printf ("%" G_GUINT64_FORMAT, ext->cache_hit);
+    else if (g_ascii_strcasecmp (name, "cache_miss") == 0)
+      val = g_strdup_printf ("%" G_GUINT64_FORMAT, ext->cache_miss);
+    else if (g_ascii_strcasecmp (name, "cache_eviction") == 0)
+      val = g_strdup_printf ("%" G_GUINT64_FORMAT, ext->cache_eviction);
+    else if (g_ascii_strcasecmp (name, "cache_bytes") == 0)
+      val = g_strdup_printf ("%" G_GSIZE_FORMAT, ext->cache_bytes);
+    g_mutex_unlock (&ext->cache_lock);
+
+    if (!val)
+      return ML_ERROR_INVALID_PARAMETER;
+
+    *value = val;
+    return ML_ERROR_NONE;
+  }
+
+  /* The number of inputs which exit at each stage of the cascade. */
+  if (ext->cascade && g_str_has_prefix (name, "cascade_"))
+    return _ml_service_extension_cascade_get_information (ext->cascade, name,
+        value);
+
+  /* The selected variant and the time spent on each variant. */
+  if (ext->variant && g_str_has_prefix (name, "variant_"))
+    return _ml_service_extension_variant_get_information (ext->variant, name,
+        value);
+
+  /* The statistics of the request priority, e.g., queue_depth_high. */
+  pos = strrchr (name, '_');
+  if (!pos)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  for (i = 0; i < ML_SERVICE_REQUEST_PRIORITY_MAX; i++) {
+    if (g_ascii_strcasecmp (pos + 1,
+            _ml_extension_priority_get_name ((ml_service_request_priority_e) i)) == 0)
+      break;
+  }
+
+  if (i == ML_SERVICE_REQUEST_PRIORITY_MAX)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  prefix = g_strndup (name, pos - name);
+  stat = &ext->stat[i];
+
+  g_mutex_lock (&ext->stat_lock);
+  if (g_ascii_strcasecmp (prefix, "queue_depth") == 0) {
+    val = g_strdup_printf ("%u", stat->depth);
+  } else if (g_ascii_strcasecmp (prefix, "processed") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, stat->processed);
+  } else if (g_ascii_strcasecmp (prefix, "dropped") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, stat->dropped);
+  } else if (g_ascii_strcasecmp (prefix, "latency_avg") == 0) {
+    val = g_strdup_printf ("%" G_GINT64_FORMAT, (stat->processed > 0) ?
+        stat->latency_total / (gint64) stat->processed : 0);
+  } else if (g_ascii_strcasecmp (prefix, "latency_max") == 0) {
+    val = g_strdup_printf ("%" G_GINT64_FORMAT, stat->latency_max);
+  }
+  g_mutex_unlock (&ext->stat_lock);
+
+  if (!val)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  *value = val;
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Internal function to add an input data to process the model in ml-service extension handle.
  */
 int
 _ml_service_extension_request (ml_service_s * mls, const char *name,
-    const ml_tensors_data_h data)
+    const ml_tensors_data_h data, ml_service_request_priority_e priority,
+    guint deadline)
 {
   ml_extension_s *ext = (ml_extension_s *) mls->priv;
   ml_extension_msg_s *msg;
@@ -794,7 +1880,9 @@ _ml_service_extension_request (ml_service_s * mls, const char *name,
 
   len = g_async_queue_length (ext->msg_queue);
 
-  if (ext->max_input > 0 && len > 0 && ext->max_input <= len) {
+  /* If the queue is full, the request of higher priority replaces the queued request of lower priority. */
+  if (ext->max_input > 0 && len > 0 && ext->max_input <= len &&
+      !_ml_extension_msg_evict (ext, priority)) {
     _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
         "Failed to push input data into the queue, the max number of input is %u.",
         ext->max_input);
@@ -807,6 +1895,11 @@ _ml_service_extension_request (ml_service_s * mls, const char *name,
   }
 
   msg->name = g_strdup (name);
+  msg->priority = priority;
+  msg->queued = g_get_monotonic_time ();
+  if (deadline > 0)
+    msg->deadline = msg->queued + deadline * G_TIME_SPAN_MILLISECOND;
+
   status = ml_tensors_data_clone (data, &msg->input);
 
   if (status != ML_ERROR_NONE) {
@@ -814,7 +1907,13 @@ _ml_service_extension_request (ml_service_s * mls, const char *name,
     _ml_error_report_return (status, "Failed to clone input data.");
   }
 
-  g_async_queue_push (ext->msg_queue, msg);
+  g_mutex_lock (&ext->stat_lock);
+  msg->seq = ext->msg_seq++;
+  ext->stat[priority].depth++;
+  g_mutex_unlock (&ext->stat_lock);
+
+  g_async_queue_push_sorted (ext->msg_queue, msg, _ml_extension_msg_compare,
+      NULL);
 
   return ML_ERROR_NONE;
 }
@@ -18,6 +18,11 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/**
+ * @brief Internal function to parse single-shot info from json and set the option to open the model.
+ */
+int _ml_service_extension_conf_parse_single_option (JsonObject *single, ml_option_h option, gchar **model_key, gchar **model_path);
+
 /**
  * @brief Internal function to create ml-service extension.
  */
@@ -53,10 +58,20 @@ int _ml_service_extension_get_output_information (ml_service_s *mls, const char
  */
 int _ml_service_extension_set_information (ml_service_s *mls, const char *name, const char *value);
 
+/**
+ * @brief Internal function to request to reload the activated model in ml-service extension.
+ */
+int _ml_service_extension_reload (ml_service_s *mls);
+
+/**
+ * @brief Internal function to get the information of ml-service extension, e.g., the statistics of the requests.
+ */
+int _ml_service_extension_get_information (ml_service_s *mls, const char *name, gchar **value);
+
 /**
  * @brief Internal function to add an input data to process the model in ml-service extension handle.
  */
-int _ml_service_extension_request (ml_service_s *mls, const char *name, const ml_tensors_data_h data);
+int _ml_service_extension_request (ml_service_s *mls, const char *name, const ml_tensors_data_h data, ml_service_request_priority_e priority, guint deadline);
 
 #ifdef __cplusplus
 }
@@ -17,6 +17,10 @@
 #include <gst/gstbuffer.h>
 #include <gst/app/app.h>
 #include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <curl/curl.h>
 #include <json-glib/json-glib.h>
 #include <nnstreamer-edge.h>
@@ -29,6 +33,81 @@
 
 #define MAX_PORT_NUM_LEN 6U
 
+/**
+ * @brief Default size of the chunk to send the model file (1 MiB).
+ */
+#define DEFAULT_CHUNK_SIZE (1024U * 1024U)
+
+/**
+ * @brief The number of retries to send the chunk when the connection is dropped.
+ */
+#define MAX_SEND_RETRY 3U
+
+/**
+ * @brief Default number of parallel range requests to download the model file.
+ */
+#define DEFAULT_DOWNLOAD_PARALLEL 4U
+
+/**
+ * @brief The min size of the model file to download with parallel range requests (16 MiB).
+ */
+#define MIN_PARALLEL_DOWNLOAD_SIZE (16U * 1024U * 1024U)
+
+/**
+ * @brief The service types to check whether the receiver already has the content.
+ */
+#define CONTENT_PROBE "content_probe"
+#define CONTENT_PROBE_REPLY "content_probe_reply"
+
+/**
+ * @brief The result of the content probe.
+ */
+#define PROBE_PENDING 0
+#define PROBE_HIT 1
+#define PROBE_MISS 2
+
+/**
+ * @brief The compression mode of the payload.
+ */
+#define COMPRESSION_NONE 0
+#define COMPRESSION_ZLIB 1
+#define COMPRESSION_AUTO 2
+
+/**
+ * @brief The minimum size of the payload to be compressed.
+ */
+#define MIN_COMPRESS_SIZE 4096U
+
+/**
+ * @brief The default max size of the decompressed payload (256 MiB).
+ */
+#define DEFAULT_MAX_RAW_SIZE (256U * 1024U * 1024U)
+
+/**
+ * @brief The max number of requests coalesced into an edge message.
+ */
+#define MAX_COALESCE 16U
+
+/**
+ * @brief The default time (in milliseconds) to wait for the requests to be coalesced.
+ */
+#define DEFAULT_COALESCE_INTERVAL 10U
+
+/**
+ * @brief The default number of worker threads to process the received data. 0 to process it in the edge callback in order.
+ */
+#define DEFAULT_WORKERS 0U
+
+/**
+ * @brief The max number of worker threads to process the received data.
+ */
+#define MAX_WORKERS 16U
+
+/**
+ * @brief The size of the block to compare the model file with the base model.
+ */
+#define DELTA_BLOCK_SIZE 4096U
+
 /**
  * @brief Data struct for options.
  */
@@ -54,12 +133,113 @@ typedef struct
 
   gchar *path; /**< A path to save the received model file */
   GHashTable *option_table;
-  GHashTable *service_table;
+  GMutex service_lock;
+  GHashTable *service_table; /**< The launched pipelines (key and ml_service_h), the workers may launch the pipelines concurrently. */
+
+  gsize chunk_size; /**< The size of chunk to send the model file. 0 to send the whole data at once. */
+  GMutex transfer_lock;
+  GCond transfer_cond;
+  GHashTable *transfer_table; /**< The model files being received in chunks (transfer-id and _mlrs_transfer_s) */
+  GHashTable *sent_files; /**< The files sent to the receiver and their content hash, to find the base model of the delta */
+
+  gchar *cache_dir; /**< A path to cache the model files downloaded from URI */
+  guint download_parallel; /**< The number of parallel range requests to download the model file */
+
+  guint dedup_timeout; /**< The time (in milliseconds) to wait for the reply of the content probe. 0 to send the data without the probe. */
+  guint probe_seq;
+  GMutex probe_lock;
+  GCond probe_cond;
+  GHashTable *probe_table; /**< The content probes waiting for the reply (probe-id and result) */
+
+  guint compression; /**< The compression mode of the payload */
+  gsize max_raw_size; /**< The max size of the decompressed payload, the peer sets the size in 'raw-size' */
+  gint peer_compression; /**< The receiver accepts the compressed payload. The receive path updates it, use atomic operations. */
+  GMutex stats_lock;
+  guint64 compress_count;
+  guint64 compress_raw_bytes;
+  guint64 compress_bytes;
+  guint64 compress_time; /**< The total time (in microseconds) to compress the payload */
+  guint64 decompress_count;
+  guint64 decompress_time; /**< The total time (in microseconds) to decompress the payload */
+
+  GHashTable *template_table; /**< The services compiled into the edge data template (key and _mlrs_service_template_s) */
+  guint coalesce; /**< The max number of requests coalesced into an edge message. 1 to send each request. */
+  guint coalesce_interval; /**< The max time (in milliseconds) the request waits to be coalesced */
+  GMutex coalesce_lock;
+  GCond coalesce_cond;
+  GThread *coalesce_thread;
+  gboolean coalesce_running;
+
+  guint workers; /**< The number of worker threads to process the received data. 0 to process it in the edge callback. The event callback is invoked in the worker threads if it is not 0. */
+  GThreadPool *worker_pool;
+  GMutex worker_lock;
+  GHashTable *worker_queues; /**< The received data waiting to be processed in order, for each service key (key and GQueue) */
+  guint queue_depth;
+  gboolean worker_stopping;
+  GHashTable *process_stats; /**< The statistics of the processing time for each service type (type and _mlrs_process_stats_s) */
 
   ml_service_offloading_mode_e offloading_mode;
   void *priv;
 } _ml_service_offloading_s;
 
+/**
+ * @brief Structure for the validator of the cached model file downloaded from URI.
+ */
+typedef struct
+{
+  gchar *etag;
+  gchar *last_modified;
+  gboolean accept_ranges;
+} _mlrs_http_meta_s;
+
+/**
+ * @brief Structure for the range of the model file downloaded in parallel.
+ */
+typedef struct
+{
+  int fd;
+  guint64 offset; /**< The offset to write next data */
+  guint64 end; /**< The last offset of the range */
+} _mlrs_http_range_s;
+
+/**
+ * @brief Structure for the model file being received in chunks.
+ */
+typedef struct
+{
+  gchar *path; /**< The path to save the model file */
+  gchar *tmp_path; /**< The temporary file to write the received chunks */
+  FILE *fp;
+  guint64 offset; /**< The size of data written in the temporary file */
+  guint64 total; /**< The size of the model file */
+  gboolean busy; /**< TRUE while a worker writes the chunk without the transfer lock */
+} _mlrs_transfer_s;
+
+/**
+ * @brief Structure for the statistics of the processing time of the received data.
+ */
+typedef struct
+{
+  guint64 count;
+  guint64 total; /**< The total processing time in microseconds */
+  guint64 max; /**< The max processing time in microseconds */
+} _mlrs_process_stats_s;
+
+/**
+ * @brief Structure for the service compiled at creation, not to parse the service for each request.
+ */
+typedef struct
+{
+  JsonNode *node;
+  const gchar *service_str;
+  ml_service_offloading_type_e service_type;
+  nns_edge_data_h data_h; /**< The edge data with the information of the service, without payload */
+
+  nns_edge_data_h pending; /**< The edge data with the requests waiting to be coalesced */
+  guint pending_count;
+  gint64 pending_time; /**< The time when the first request is coalesced */
+} _mlrs_service_template_s;
+
 /**
  * @brief Get ml-service node type from ml_option.
  */
@@ -232,23 +412,222 @@ curl_mem_write_cb (void *data, size_t size, size_t nmemb, void *clientp)
 }
 
 /**
- * @brief Register model file given by the offloading sender.
+ * @brief Link (or copy if failed to link) the file to the model path.
+ * The source file is replaced by rename, so the linked model file is not changed.
  */
 static gboolean
-_mlrs_model_register (gchar * service_key, nns_edge_data_h data_h,
-    void *data, nns_size_t data_len, const gchar * dir_path)
+_mlrs_install_file (const gchar * src_path, const gchar * model_path)
+{
+  g_autofree gchar *tmp_path = NULL;
+  g_autoptr (GFile) src = NULL;
+  g_autoptr (GFile) dest = NULL;
+  g_autoptr (GError) err = NULL;
+
+  tmp_path = g_strdup_printf ("%s.tmp", model_path);
+  g_remove (tmp_path);
+
+  if (link (src_path, tmp_path) != 0) {
+    src = g_file_new_for_path (src_path);
+    dest = g_file_new_for_path (tmp_path);
+
+    if (!g_file_copy (src, dest, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL,
+            &err)) {
+      _ml_loge ("Failed to copy the model file: %s",
+          err ? err->message : "unknown error");
+      return FALSE;
+    }
+  }
+
+  if (g_rename (tmp_path, model_path) != 0) {
+    _ml_loge ("Failed to rename the file '%s': %s", tmp_path,
+        g_strerror (errno));
+    g_remove (tmp_path);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Compute the content hash (SHA-256) of the file.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_mlrs_compute_file_hash (const gchar * path)
+{
+  GChecksum *checksum;
+  FILE *fp;
+  guint8 buffer[65536];
+  gsize len;
+  gchar *hash = NULL;
+
+  fp = g_fopen (path, "rb");
+  if (!fp) {
+    _ml_loge ("Failed to open the file '%s': %s", path, g_strerror (errno));
+    return NULL;
+  }
+
+  checksum = g_checksum_new (G_CHECKSUM_SHA256);
+  while ((len = fread (buffer, 1, sizeof (buffer), fp)) > 0)
+    g_checksum_update (checksum, buffer, len);
+
+  if (!ferror (fp))
+    hash = g_strdup (g_checksum_get_string (checksum));
+
+  g_checksum_free (checksum);
+  fclose (fp);
+  return hash;
+}
+
+/**
+ * @brief Check the content hash is the SHA-256 string (64 lowercase hex digits).
+ * The hash from the peer is used as the file name of the blob, it should not have the path separator.
+ */
+static gboolean
+_mlrs_is_valid_hash (const gchar * hash)
+{
+  guint i;
+
+  if (!hash)
+    return FALSE;
+
+  for (i = 0; i < 64; i++) {
+    if (!g_ascii_isdigit (hash[i]) && (hash[i] < 'a' || hash[i] > 'f'))
+      return FALSE;
+  }
+
+  return (hash[64] == '\0');
+}
+
+/**
+ * @brief Get the path of the content-addressed blob in the model directory.
+ * @return The path of the blob, or NULL if the hash is invalid.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_mlrs_get_blob_path (const gchar * dir_path, const gchar * hash)
+{
+  if (!_mlrs_is_valid_hash (hash))
+    return NULL;
+
+  return g_build_path (G_DIR_SEPARATOR_S, dir_path, ".blobs", hash, NULL);
+}
+
+/**
+ * @brief Check whether the sender deduplicates the content, so that the receiver keeps the blob.
+ */
+static gboolean
+_mlrs_use_dedup (nns_edge_data_h data_h)
+{
+  g_autofree gchar *dedup = NULL;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "content-dedup",
+          &dedup))
+    return FALSE;
+
+  return (g_ascii_strcasecmp (dedup, "true") == 0);
+}
+
+/**
+ * @brief Remove the blobs which are not linked with any model file.
+ * The blob is the hard link of the model file, the link count is the reference count. The blob used by other model files is kept.
+ */
+static void
+_mlrs_blob_release (const gchar * dir_path)
+{
+  g_autofree gchar *blob_dir = NULL;
+  GStatBuf blob_st;
+  const gchar *name;
+  GDir *dir;
+
+  blob_dir = g_build_path (G_DIR_SEPARATOR_S, dir_path, ".blobs", NULL);
+  dir = g_dir_open (blob_dir, 0, NULL);
+  if (!dir)
+    return;
+
+  while ((name = g_dir_read_name (dir))) {
+    g_autofree gchar *blob_path = g_build_path (G_DIR_SEPARATOR_S, blob_dir,
+        name, NULL);
+
+    if (g_stat (blob_path, &blob_st) == 0 && blob_st.st_nlink <= 1)
+      g_remove (blob_path);
+  }
+
+  g_dir_close (dir);
+}
+
+/**
+ * @brief Keep the received model file as the content-addressed blob, to reuse it when the same model is sent again.
+ * The blob is stored only when the sender deduplicates the content.
+ */
+static void
+_mlrs_blob_store (const gchar * dir_path, const gchar * hash,
+    const gchar * model_path)
+{
+  g_autofree gchar *blob_dir = NULL;
+  g_autofree gchar *blob_path = NULL;
+
+  /* The replaced model file may leave the blob. */
+  _mlrs_blob_release (dir_path);
+
+  if (!hash)
+    return;
+
+  blob_dir = g_build_path (G_DIR_SEPARATOR_S, dir_path, ".blobs", NULL);
+  blob_path = _mlrs_get_blob_path (dir_path, hash);
+
+  if (!blob_path || g_file_test (blob_path, G_FILE_TEST_IS_REGULAR))
+    return;
+
+  /* Link the model file not to use more storage. */
+  if (g_mkdir_with_parents (blob_dir, 0755) < 0 ||
+      link (model_path, blob_path) != 0) {
+    _ml_logw ("Failed to keep the model file '%s' as blob: %s", model_path,
+        g_strerror (errno));
+  }
+}
+
+/**
+ * @brief Restore the model file from the content-addressed blob.
+ * The model file is not written again if it is the same file as the blob.
+ */
+static gboolean
+_mlrs_blob_restore (const gchar * dir_path, const gchar * hash,
+    const gchar * model_path)
+{
+  g_autofree gchar *blob_path = NULL;
+  GStatBuf blob_st, model_st;
+
+  if (!_mlrs_is_valid_hash (hash)) {
+    _ml_error_report_return (FALSE,
+        "Failed to restore the model, invalid content hash.");
+  }
+
+  blob_path = _mlrs_get_blob_path (dir_path, hash);
+  if (g_stat (blob_path, &blob_st) != 0)
+    return FALSE;
+
+  if (g_stat (model_path, &model_st) == 0 && blob_st.st_dev == model_st.st_dev
+      && blob_st.st_ino == model_st.st_ino)
+    return TRUE;
+
+  return _mlrs_install_file (blob_path, model_path);
+}
+
+/**
+ * @brief Register the received model file.
+ */
+static gboolean
+_mlrs_model_register_path (gchar * service_key, nns_edge_data_h data_h,
+    const gchar * model_path)
 {
   guint version = 0;
   g_autofree gchar *description = NULL;
-  g_autofree gchar *name = NULL;
   g_autofree gchar *activate = NULL;
-  g_autofree gchar *model_path = NULL;
   gboolean active_bool = TRUE;
-  GError *error = NULL;
 
   if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "description",
           &description)
-      || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "name", &name)
       || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "activate",
           &activate)) {
     _ml_loge ("Failed to get info from data handle.");
@@ -256,13 +635,6 @@ _mlrs_model_register (gchar * service_key, nns_edge_data_h data_h,
   }
 
   active_bool = _mlrs_parse_activate (activate);
-  model_path = g_build_path (G_DIR_SEPARATOR_S, dir_path, name, NULL);
-  if (!g_file_set_contents (model_path, (char *) data, data_len, &error)) {
-    _ml_loge ("Failed to write data to file: %s",
-        error ? error->message : "unknown error");
-    g_clear_error (&error);
-    return FALSE;
-  }
 
   /**
    * @todo Hashing the path. Where is the default path to save the model file?
@@ -277,82 +649,1379 @@ _mlrs_model_register (gchar * service_key, nns_edge_data_h data_h,
 }
 
 /**
- * @brief Get path to save the model given from offloading sender.
- * @note The caller is responsible for freeing the returned data using g_free().
+ * @brief Register model file given by the offloading sender.
  */
-static gchar *
-_mlrs_get_model_dir_path (_ml_service_offloading_s * offloading_s,
-    const gchar * service_key)
+static gboolean
+_mlrs_model_register (gchar * service_key, nns_edge_data_h data_h,
+    void *data, nns_size_t data_len, const gchar * dir_path)
 {
-  g_autofree gchar *dir_path = NULL;
+  g_autofree gchar *name = NULL;
+  g_autofree gchar *model_path = NULL;
+  g_autofree gchar *hash = NULL;
+  GError *error = NULL;
 
-  if (offloading_s->path) {
-    dir_path = g_strdup (offloading_s->path);
-  } else {
-    g_autofree gchar *current_dir = g_get_current_dir ();
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "name", &name)) {
+    _ml_loge ("Failed to get info from data handle.");
+    return FALSE;
+  }
 
-    dir_path = g_build_path (G_DIR_SEPARATOR_S, current_dir, service_key, NULL);
-    if (g_mkdir_with_parents (dir_path, 0755) < 0) {
-      _ml_loge ("Failed to create directory '%s': %s", dir_path,
-          g_strerror (errno));
-      return NULL;
-    }
+  model_path = g_build_path (G_DIR_SEPARATOR_S, dir_path, name, NULL);
+  if (!g_file_set_contents (model_path, (char *) data, data_len, &error)) {
+    _ml_loge ("Failed to write data to file: %s",
+        error ? error->message : "unknown error");
+    g_clear_error (&error);
+    return FALSE;
   }
 
-  return g_steal_pointer (&dir_path);
+  if (_mlrs_use_dedup (data_h))
+    hash = g_compute_checksum_for_data (G_CHECKSUM_SHA256, data, data_len);
+  _mlrs_blob_store (dir_path, hash, model_path);
+
+  return _mlrs_model_register_path (service_key, data_h, model_path);
 }
 
 /**
- * @brief Get data from gievn uri
+ * @brief Release the model file being received in chunks.
+ * The temporary file is not removed, to resume the transfer.
+ */
+static void
+_mlrs_transfer_free (gpointer data)
+{
+  _mlrs_transfer_s *transfer = (_mlrs_transfer_s *) data;
+
+  if (!transfer)
+    return;
+
+  if (transfer->fp)
+    fclose (transfer->fp);
+
+  g_free (transfer->path);
+  g_free (transfer->tmp_path);
+  g_free (transfer);
+}
+
+/**
+ * @brief Check the transfer id is the alphanumeric token, which is used in the name of the temporary file.
  */
 static gboolean
-_mlrs_get_data_from_uri (gchar * uri, GByteArray * array)
+_mlrs_is_valid_transfer_id (const gchar * transfer_id)
 {
-  CURL *curl;
-  CURLcode res;
-  gboolean ret = FALSE;
+  guint i;
 
-  curl = curl_easy_init ();
-  if (curl) {
-    if (CURLE_OK != curl_easy_setopt (curl, CURLOPT_URL, (gchar *) uri) ||
-        CURLE_OK != curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1L) ||
-        CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION,
-            curl_mem_write_cb) ||
-        CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEDATA,
-            (void *) array)) {
-      _ml_loge ("Failed to set option for curl easy handle.");
-      ret = FALSE;
-      goto done;
-    }
+  if (!STR_IS_VALID (transfer_id))
+    return FALSE;
 
-    res = curl_easy_perform (curl);
+  for (i = 0; transfer_id[i] != '\0'; i++) {
+    if (i >= 64 || !g_ascii_isalnum (transfer_id[i]))
+      return FALSE;
+  }
 
-    if (res != CURLE_OK) {
-      _ml_loge ("curl_easy_perform failed: %s", curl_easy_strerror (res));
-      ret = FALSE;
-      goto done;
+  return TRUE;
+}
+
+/**
+ * @brief Prepare the temporary file to write the chunks of model file.
+ * If the temporary file exists (e.g., the connection was dropped), the transfer resumes from the end of the file.
+ */
+static _mlrs_transfer_s *
+_mlrs_transfer_new (const gchar * dir_path, const gchar * name,
+    const gchar * transfer_id, guint64 total)
+{
+  _mlrs_transfer_s *transfer;
+  g_autofree gchar *tmp_name = NULL;
+  off_t size;
+
+  if (!_mlrs_is_valid_transfer_id (transfer_id)) {
+    _ml_error_report_return (NULL,
+        "Invalid transfer id of the model file, it should be an alphanumeric token.");
+  }
+
+  transfer = g_try_new0 (_mlrs_transfer_s, 1);
+  if (!transfer) {
+    _ml_loge ("Failed to allocate memory for the model transfer.");
+    return NULL;
+  }
+
+  tmp_name = g_strdup_printf (".%s.%s.part", name, transfer_id);
+  transfer->path = g_build_path (G_DIR_SEPARATOR_S, dir_path, name, NULL);
+  transfer->tmp_path = g_build_path (G_DIR_SEPARATOR_S, dir_path, tmp_name,
+      NULL);
+  transfer->total = total;
+
+  transfer->fp = g_fopen (transfer->tmp_path, "r+b");
+  if (transfer->fp) {
+    if (fseeko (transfer->fp, 0, SEEK_END) == 0 &&
+        (size = ftello (transfer->fp)) >= 0 && (guint64) size <= total) {
+      transfer->offset = (guint64) size;
+      _ml_logi ("Resume the model transfer '%s' from %" G_GUINT64_FORMAT ".",
+          name, transfer->offset);
+    } else {
+      fclose (transfer->fp);
+      transfer->fp = NULL;
     }
+  }
 
-    ret = TRUE;
+  if (!transfer->fp) {
+    transfer->fp = g_fopen (transfer->tmp_path, "w+b");
+    transfer->offset = 0;
   }
 
-done:
-  if (curl)
-    curl_easy_cleanup (curl);
-  return ret;
+  if (!transfer->fp) {
+    _ml_loge ("Failed to open the file '%s': %s", transfer->tmp_path,
+        g_strerror (errno));
+    _mlrs_transfer_free (transfer);
+    return NULL;
+  }
+
+  return transfer;
 }
 
 /**
- * @brief Process ml offloading service
+ * @brief Write the chunk of model file given by the offloading sender.
+ * The chunk is written without the transfer lock, the other chunks of the same transfer wait until the chunk is written.
+ * @note The caller is responsible for freeing the returned model path using g_free(). It is set only when the model file is completely received.
  */
 static int
-_mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
+_mlrs_model_receive_chunk (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h, void *data, nns_size_t data_len,
+    const gchar * dir_path, const gchar * transfer_id, gchar ** model_path)
+{
+  g_autofree gchar *name = NULL;
+  g_autofree gchar *offset_str = NULL;
+  g_autofree gchar *total_str = NULL;
+  g_autofree gchar *checksum = NULL;
+  g_autofree gchar *content_hash = NULL;
+  g_autofree gchar *computed = NULL;
+  g_autofree gchar *hash = NULL;
+  _mlrs_transfer_s *transfer;
+  guint64 offset, total;
+  gboolean finished = FALSE;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "name", &name)
+      || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "chunk-offset",
+          &offset_str)
+      || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "total-size",
+          &total_str)
+      || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h,
+          "chunk-checksum", &checksum)
+      || NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h,
+          "content-hash", &content_hash)) {
+    _ml_error_report_return (NNS_EDGE_ERROR_INVALID_PARAMETER,
+        "Failed to get the chunk info from data handle.");
+  }
+
+  if (!_mlrs_is_valid_hash (content_hash)) {
+    _ml_error_report_return (NNS_EDGE_ERROR_INVALID_PARAMETER,
+        "Invalid content hash of the model file.");
+  }
+
+  offset = g_ascii_strtoull (offset_str, NULL, 10);
+  total = g_ascii_strtoull (total_str, NULL, 10);
+  if (offset + data_len > total) {
+    _ml_error_report_return (NNS_EDGE_ERROR_INVALID_PARAMETER,
+        "The chunk (offset %" G_GUINT64_FORMAT ") exceeds the model size.",
+        offset);
+  }
+
+  computed = g_compute_checksum_for_data (G_CHECKSUM_SHA256, data, data_len);
+  if (g_ascii_strcasecmp (computed, checksum) != 0) {
+    _ml_error_report_return (NNS_EDGE_ERROR_IO,
+        "The checksum of the chunk (offset %" G_GUINT64_FORMAT
+        ") is mismatched, drop it.", offset);
+  }
+
+  g_mutex_lock (&offloading_s->transfer_lock);
+
+  /* Wait for the worker writing other chunk of the transfer. The transfer may be removed after waiting. */
+  while ((transfer = g_hash_table_lookup (offloading_s->transfer_table,
+              transfer_id)) && transfer->busy)
+    g_cond_wait (&offloading_s->transfer_cond, &offloading_s->transfer_lock);
+
+  if (!transfer) {
+    transfer = _mlrs_transfer_new (dir_path, name, transfer_id, total);
+    if (!transfer) {
+      g_mutex_unlock (&offloading_s->transfer_lock);
+      return NNS_EDGE_ERROR_IO;
+    }
+
+    g_hash_table_insert (offloading_s->transfer_table, g_strdup (transfer_id),
+        transfer);
+  }
+
+  transfer->busy = TRUE;
+  g_mutex_unlock (&offloading_s->transfer_lock);
+
+  if (offset + data_len <= transfer->offset) {
+    /* Already written before the connection was dropped. */
+    goto done;
+  }
+
+  if (offset > transfer->offset) {
+    _ml_error_report ("The chunk (offset %" G_GUINT64_FORMAT
+        ") is out of order, expected offset is %" G_GUINT64_FORMAT ".",
+        offset, transfer->offset);
+    ret = NNS_EDGE_ERROR_IO;
+    goto done;
+  }
+
+  if (fseeko (transfer->fp, (off_t) offset, SEEK_SET) != 0 ||
+      fwrite (data, 1, data_len, transfer->fp) != data_len) {
+    _ml_error_report ("Failed to write the chunk to file '%s': %s",
+        transfer->tmp_path, g_strerror (errno));
+    ret = NNS_EDGE_ERROR_IO;
+    goto done;
+  }
+
+  transfer->offset = offset + data_len;
+
+  if (transfer->offset == transfer->total) {
+    finished = TRUE;
+
+    /* Replace the model file with the completely received file. */
+    if (fflush (transfer->fp) != 0 || fsync (fileno (transfer->fp)) != 0) {
+      _ml_error_report ("Failed to flush the file '%s'.", transfer->tmp_path);
+      ret = NNS_EDGE_ERROR_IO;
+      goto done;
+    }
+
+    fclose (transfer->fp);
+    transfer->fp = NULL;
+
+    /* The resumed transfer trusts the temporary file, check the whole file before replacing the model. */
+    hash = _mlrs_compute_file_hash (transfer->tmp_path);
+    if (g_strcmp0 (hash, content_hash) != 0) {
+      _ml_error_report
+          ("The content hash of the received file '%s' is mismatched, drop it.",
+          transfer->tmp_path);
+      g_remove (transfer->tmp_path);
+      ret = NNS_EDGE_ERROR_IO;
+      goto done;
+    }
+
+    if (g_rename (transfer->tmp_path, transfer->path) != 0) {
+      _ml_error_report ("Failed to rename the file '%s': %s",
+          transfer->tmp_path, g_strerror (errno));
+      g_remove (transfer->tmp_path);
+      ret = NNS_EDGE_ERROR_IO;
+    } else {
+      _mlrs_blob_store (dir_path, _mlrs_use_dedup (data_h) ? hash : NULL,
+          transfer->path);
+      *model_path = g_strdup (transfer->path);
+    }
+  }
+
+done:
+  g_mutex_lock (&offloading_s->transfer_lock);
+  transfer->busy = FALSE;
+  if (finished)
+    g_hash_table_remove (offloading_s->transfer_table, transfer_id);
+  g_cond_broadcast (&offloading_s->transfer_cond);
+  g_mutex_unlock (&offloading_s->transfer_lock);
+
+  return ret;
+}
+
+/**
+ * @brief Get path to save the model given from offloading sender.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_mlrs_get_model_dir_path (_ml_service_offloading_s * offloading_s,
+    const gchar * service_key)
+{
+  g_autofree gchar *dir_path = NULL;
+
+  if (offloading_s->path) {
+    dir_path = g_strdup (offloading_s->path);
+  } else {
+    g_autofree gchar *current_dir = g_get_current_dir ();
+
+    dir_path = g_build_path (G_DIR_SEPARATOR_S, current_dir, service_key, NULL);
+    if (g_mkdir_with_parents (dir_path, 0755) < 0) {
+      _ml_loge ("Failed to create directory '%s': %s", dir_path,
+          g_strerror (errno));
+      return NULL;
+    }
+  }
+
+  return g_steal_pointer (&dir_path);
+}
+
+/**
+ * @brief Convert the data with given converter (zlib compressor or decompressor).
+ */
+static gboolean
+_mlrs_convert (GConverter * converter, const guint8 * data, gsize len,
+    gsize limit, GByteArray * out)
+{
+  guint8 buffer[16384];
+  gsize bytes_read, bytes_written;
+  GConverterResult result;
+  GError *error = NULL;
+
+  do {
+    result = g_converter_convert (converter, data, len, buffer,
+        sizeof (buffer), G_CONVERTER_INPUT_AT_END, &bytes_read, &bytes_written,
+        &error);
+    if (result == G_CONVERTER_ERROR) {
+      _ml_loge ("Failed to convert the payload: %s",
+          error ? error->message : "unknown error");
+      g_clear_error (&error);
+      return FALSE;
+    }
+
+    /* Stop converting the data as soon as the output exceeds the limit. */
+    if (bytes_written > limit - out->len) {
+      _ml_loge ("The converted payload exceeds the limit (%" G_GSIZE_FORMAT
+          ").", limit);
+      return FALSE;
+    }
+
+    data += bytes_read;
+    len -= bytes_read;
+    g_byte_array_append (out, buffer, bytes_written);
+  } while (result != G_CONVERTER_FINISHED);
+
+  return TRUE;
+}
+
+/**
+ * @brief Check whether the data is already compressed (gzip, zip, zstd, xz and lz4 frame).
+ */
+static gboolean
+_mlrs_is_compressed_content (const guint8 * data, gsize len)
+{
+  if (len < 4)
+    return FALSE;
+
+  return ((data[0] == 0x1f && data[1] == 0x8b) ||
+      (data[0] == 'P' && data[1] == 'K' && data[2] == 0x03 && data[3] == 0x04)
+      || (data[0] == 0x28 && data[1] == 0xb5 && data[2] == 0x2f
+          && data[3] == 0xfd) || (data[0] == 0xfd && data[1] == '7'
+          && data[2] == 'z' && data[3] == 'X') || (data[0] == 0x04
+          && data[1] == 0x22 && data[2] == 0x4d && data[3] == 0x18));
+}
+
+/**
+ * @brief Compress the payload if the compression is enabled and the payload is compressible.
+ * @return The compressed payload, or NULL to send the original data.
+ */
+static GByteArray *
+_mlrs_compress (_ml_service_offloading_s * offloading_s, const void *data,
+    gsize len)
+{
+  GZlibCompressor *compressor;
+  GByteArray *out;
+  gint64 start_time;
+  gboolean compressed;
+
+  switch (offloading_s->compression) {
+    case COMPRESSION_ZLIB:
+      break;
+    case COMPRESSION_AUTO:
+      if (g_atomic_int_get (&offloading_s->peer_compression))
+        break;
+      return NULL;
+    default:
+      return NULL;
+  }
+
+  if (len < MIN_COMPRESS_SIZE ||
+      _mlrs_is_compressed_content ((const guint8 *) data, len))
+    return NULL;
+
+  start_time = g_get_monotonic_time ();
+
+  compressor = g_zlib_compressor_new (G_ZLIB_COMPRESSOR_FORMAT_ZLIB, -1);
+  out = g_byte_array_sized_new (len / 2);
+  compressed = _mlrs_convert (G_CONVERTER (compressor), data, len, G_MAXUINT,
+      out);
+  g_object_unref (compressor);
+
+  /* Send the original data if the payload is not compressible. */
+  if (!compressed || out->len >= len - len / 10) {
+    g_byte_array_free (out, TRUE);
+    return NULL;
+  }
+
+  g_mutex_lock (&offloading_s->stats_lock);
+  offloading_s->compress_count++;
+  offloading_s->compress_raw_bytes += len;
+  offloading_s->compress_bytes += out->len;
+  offloading_s->compress_time += g_get_monotonic_time () - start_time;
+  g_mutex_unlock (&offloading_s->stats_lock);
+
+  return out;
+}
+
+/**
+ * @brief Add the payload to edge data, the compressed payload is added with the info of the compression.
+ */
+static int
+_mlrs_add_payload (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h, void *data, gsize len)
+{
+  GByteArray *compressed;
+  gchar value[32];
+  int ret;
+
+  compressed = _mlrs_compress (offloading_s, data, len);
+  if (!compressed)
+    return nns_edge_data_add (data_h, data, len, NULL);
+
+  g_snprintf (value, sizeof (value), "%" G_GSIZE_FORMAT, len);
+
+  ret = nns_edge_data_set_info (data_h, "service-compression", "zlib");
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "raw-size", value);
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    ret = nns_edge_data_add (data_h, compressed->data, compressed->len,
+        g_free);
+  }
+
+  /* Edge data releases the compressed data. */
+  g_byte_array_free (compressed, NNS_EDGE_ERROR_NONE != ret);
+  return ret;
+}
+
+/**
+ * @brief Decompress the payload received with the info of the compression.
+ * @return The decompressed payload, or NULL if the payload is not compressed.
+ */
+static GByteArray *
+_mlrs_decompress (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h, const void *data, gsize len, int *ret)
+{
+  g_autofree gchar *method = NULL;
+  g_autofree gchar *raw_size = NULL;
+  GZlibDecompressor *decompressor;
+  GByteArray *out;
+  gint64 start_time;
+  guint64 size;
+  gboolean decompressed;
+
+  *ret = NNS_EDGE_ERROR_NONE;
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h,
+          "service-compression", &method))
+    return NULL;
+
+  if (!g_str_equal (method, "zlib") ||
+      NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "raw-size",
+          &raw_size)) {
+    _ml_error_report ("Unknown compression '%s' of the payload.", method);
+    *ret = NNS_EDGE_ERROR_NOT_SUPPORTED;
+    return NULL;
+  }
+
+  size = g_ascii_strtoull (raw_size, NULL, 10);
+  if (size == 0 || size > G_MAXUINT) {
+    _ml_error_report ("Invalid size '%s' of the compressed payload.", raw_size);
+    *ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    return NULL;
+  }
+
+  if (size > offloading_s->max_raw_size) {
+    _ml_error_report
+        ("The size '%s' of the compressed payload exceeds the max raw size (%"
+        G_GSIZE_FORMAT ").", raw_size, offloading_s->max_raw_size);
+    *ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    return NULL;
+  }
+
+  start_time = g_get_monotonic_time ();
+
+  decompressor = g_zlib_decompressor_new (G_ZLIB_COMPRESSOR_FORMAT_ZLIB);
+  out = g_byte_array_sized_new ((guint) size);
+  decompressed = _mlrs_convert (G_CONVERTER (decompressor), data, len,
+      (gsize) size, out);
+  g_object_unref (decompressor);
+
+  if (!decompressed || out->len != size) {
+    _ml_error_report ("Failed to decompress the payload.");
+    g_byte_array_free (out, TRUE);
+    *ret = NNS_EDGE_ERROR_IO;
+    return NULL;
+  }
+
+  g_mutex_lock (&offloading_s->stats_lock);
+  offloading_s->decompress_count++;
+  offloading_s->decompress_time += g_get_monotonic_time () - start_time;
+  g_mutex_unlock (&offloading_s->stats_lock);
+
+  return out;
+}
+
+/**
+ * @brief Find the base model file of the delta with the content hash.
+ * The hash should be validated with _mlrs_is_valid_hash().
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_mlrs_find_delta_base (_ml_service_offloading_s * offloading_s,
+    const gchar * dir_path, const gchar * hash)
+{
+  g_autofree gchar *blob_path = NULL;
+  g_autofree gchar *current = NULL;
+  gchar *base_path = NULL;
+  GHashTableIter iter;
+  gpointer path, sent_hash;
+
+  /* The received model is kept as the blob. */
+  if (dir_path) {
+    blob_path = _mlrs_get_blob_path (dir_path, hash);
+    if (blob_path && g_file_test (blob_path, G_FILE_TEST_IS_REGULAR))
+      return g_steal_pointer (&blob_path);
+  }
+
+  /* The file sent to remote, such as the pre-trained model of training offloading. */
+  g_mutex_lock (&offloading_s->transfer_lock);
+  g_hash_table_iter_init (&iter, offloading_s->sent_files);
+  while (!base_path && g_hash_table_iter_next (&iter, &path, &sent_hash)) {
+    if (g_strcmp0 ((gchar *) sent_hash, hash) == 0)
+      base_path = g_strdup ((gchar *) path);
+  }
+  g_mutex_unlock (&offloading_s->transfer_lock);
+
+  /* The file may be changed after it is sent. */
+  if (base_path) {
+    current = _mlrs_compute_file_hash (base_path);
+    if (g_strcmp0 (current, hash) != 0)
+      g_clear_pointer (&base_path, g_free);
+  }
+
+  return base_path;
+}
+
+/**
+ * @brief Rebuild the model file from the delta and the base model.
+ * The delta consists of the bitmap of the changed blocks and the changed blocks.
+ * @return The rebuilt model, or NULL if the data is not the delta.
+ */
+static GByteArray *
+_mlrs_apply_delta (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h, const gchar * dir_path, const guint8 * data,
+    gsize len, int *ret)
+{
+  g_autofree gchar *base_hash = NULL;
+  g_autofree gchar *block_str = NULL;
+  g_autofree gchar *total_str = NULL;
+  g_autofree gchar *content_hash = NULL;
+  g_autofree gchar *base_path = NULL;
+  g_autofree gchar *hash = NULL;
+  GByteArray *out = NULL;
+  guint64 total, block_size, nblocks, bitmap_len, i, offset, pos, blen;
+  FILE *fp = NULL;
+
+  *ret = NNS_EDGE_ERROR_NONE;
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "delta-base",
+          &base_hash))
+    return NULL;
+
+  *ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h,
+          "delta-block-size", &block_str) ||
+      NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "total-size",
+          &total_str) ||
+      NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "content-hash",
+          &content_hash)) {
+    _ml_error_report ("Failed to get the information of the delta.");
+    return NULL;
+  }
+
+  /* The base hash is used as the file name of the blob. */
+  if (!_mlrs_is_valid_hash (base_hash) || !_mlrs_is_valid_hash (content_hash)) {
+    _ml_error_report ("Invalid content hash of the delta.");
+    return NULL;
+  }
+
+  block_size = g_ascii_strtoull (block_str, NULL, 10);
+  total = g_ascii_strtoull (total_str, NULL, 10);
+  if (block_size == 0 || total == 0 || total > G_MAXUINT) {
+    _ml_error_report ("Invalid block size or total size of the delta.");
+    return NULL;
+  }
+
+  nblocks = (total + block_size - 1) / block_size;
+  bitmap_len = (nblocks + 7) / 8;
+  if (len < bitmap_len) {
+    _ml_error_report ("Invalid size of the delta.");
+    return NULL;
+  }
+
+  base_path = _mlrs_find_delta_base (offloading_s, dir_path, base_hash);
+  if (!base_path) {
+    _ml_error_report ("Failed to find the base model '%s' of the delta.",
+        base_hash);
+    *ret = NNS_EDGE_ERROR_IO;
+    return NULL;
+  }
+
+  fp = g_fopen (base_path, "rb");
+  if (!fp) {
+    _ml_error_report ("Failed to open the base model '%s'.", base_path);
+    *ret = NNS_EDGE_ERROR_IO;
+    return NULL;
+  }
+
+  out = g_byte_array_sized_new ((guint) total);
+  g_byte_array_set_size (out, (guint) total);
+
+  pos = bitmap_len;
+  for (i = 0; i < nblocks; i++) {
+    offset = i * block_size;
+    blen = MIN (block_size, total - offset);
+
+    if (data[i / 8] & (1U << (i % 8))) {
+      if (pos + blen > len)
+        break;
+
+      memcpy (out->data + offset, data + pos, blen);
+      pos += blen;
+    } else if (fseeko (fp, (off_t) offset, SEEK_SET) != 0 ||
+        fread (out->data + offset, 1, blen, fp) != blen) {
+      break;
+    }
+  }
+
+  fclose (fp);
+
+  /* Verify the rebuilt model before registering it. */
+  if (i == nblocks && pos == len)
+    hash = g_compute_checksum_for_data (G_CHECKSUM_SHA256, out->data, out->len);
+
+  if (g_strcmp0 (hash, content_hash) != 0) {
+    _ml_error_report ("Failed to rebuild the model from the delta.");
+    g_byte_array_free (out, TRUE);
+    *ret = NNS_EDGE_ERROR_IO;
+    return NULL;
+  }
+
+  *ret = NNS_EDGE_ERROR_NONE;
+  return out;
+}
+
+/**
+ * @brief Check whether the receiver already has the content of the probe, and register it with the existing content.
+ * @return TRUE if the content is registered without receiving the data.
+ */
+static gboolean
+_mlrs_content_probe_register (nns_edge_data_h data_h, const gchar * service_key,
+    const gchar * dir_path, const gchar * hash,
+    ml_service_event_e * event_type)
+{
+  g_autofree gchar *target_str = NULL;
+  ml_service_offloading_type_e target;
+
+  /* The hash from the peer is used as the file name, do not find the content with invalid hash. */
+  if (!_mlrs_is_valid_hash (hash)) {
+    _ml_error_report_return (FALSE,
+        "Failed to find the content of the probe, invalid content hash.");
+  }
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "target-type",
+          &target_str))
+    return FALSE;
+
+  target = _mlrs_get_service_type (target_str);
+
+  if (target == ML_SERVICE_OFFLOADING_TYPE_MODEL_RAW) {
+    g_autofree gchar *name = NULL;
+    g_autofree gchar *model_path = NULL;
+
+    if (!dir_path ||
+        NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "name", &name))
+      return FALSE;
+
+    model_path = g_build_path (G_DIR_SEPARATOR_S, dir_path, name, NULL);
+    if (!_mlrs_blob_restore (dir_path, hash, model_path))
+      return FALSE;
+
+    _mlrs_blob_release (dir_path);
+
+    if (!_mlrs_model_register_path ((gchar *) service_key, data_h, model_path))
+      return FALSE;
+
+    *event_type = ML_SERVICE_EVENT_MODEL_REGISTERED;
+    return TRUE;
+  }
+
+  if (target == ML_SERVICE_OFFLOADING_TYPE_PIPELINE_RAW) {
+    g_autofree gchar *description = NULL;
+    g_autofree gchar *stored = NULL;
+    gsize len;
+
+    if (ML_ERROR_NONE != ml_service_pipeline_get (service_key, &description)
+        || !description)
+      return FALSE;
+
+    /* The description may be sent with or without the null terminator. */
+    len = strlen (description);
+    stored = g_compute_checksum_for_data (G_CHECKSUM_SHA256,
+        (const guchar *) description, len);
+    if (g_strcmp0 (stored, hash) != 0) {
+      g_free (stored);
+      stored = g_compute_checksum_for_data (G_CHECKSUM_SHA256,
+          (const guchar *) description, len + 1);
+      if (g_strcmp0 (stored, hash) != 0)
+        return FALSE;
+    }
+
+    *event_type = ML_SERVICE_EVENT_PIPELINE_REGISTERED;
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Process the content probe and reply to the sender whether the data is required.
+ */
+static int
+_mlrs_process_content_probe (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h, const gchar * service_key, const gchar * dir_path,
+    ml_service_event_e * event_type)
+{
+  nns_edge_data_h reply_h = NULL;
+  g_autofree gchar *hash = NULL;
+  g_autofree gchar *probe_id = NULL;
+  g_autofree gchar *client_id = NULL;
+  gboolean hit = FALSE;
+  int ret;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "content-hash",
+          &hash) ||
+      NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "probe-id",
+          &probe_id)) {
+    _ml_error_report_return (NNS_EDGE_ERROR_INVALID_PARAMETER,
+        "Failed to get the content hash of the probe.");
+  }
+
+  hit = _mlrs_content_probe_register (data_h, service_key, dir_path, hash,
+      event_type);
+
+  ret = nns_edge_data_create (&reply_h);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report_return (ret, "Failed to create an edge data.");
+  }
+
+  /* The query server finds the connection to reply with client id. */
+  if (NNS_EDGE_ERROR_NONE == nns_edge_data_get_info (data_h, "client_id",
+          &client_id)) {
+    nns_edge_data_set_info (reply_h, "client_id", client_id);
+  }
+
+  ret = nns_edge_data_set_info (reply_h, "service-type", CONTENT_PROBE_REPLY);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (reply_h, "service-key", service_key);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (reply_h, "probe-id", probe_id);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (reply_h, "probe-result", hit ? "hit" : "miss");
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (reply_h, "accept-compression", "zlib");
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_add (reply_h, probe_id, strlen (probe_id) + 1, NULL);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_send (offloading_s->edge_h, reply_h);
+
+  if (NNS_EDGE_ERROR_NONE != ret)
+    _ml_error_report ("Failed to reply to the content probe.");
+
+  nns_edge_data_destroy (reply_h);
+  return ret;
+}
+
+/**
+ * @brief Resolve the content probe waiting for the reply.
+ */
+static void
+_mlrs_process_content_probe_reply (_ml_service_offloading_s * offloading_s,
+    nns_edge_data_h data_h)
+{
+  g_autofree gchar *probe_id = NULL;
+  g_autofree gchar *result = NULL;
+  g_autofree gchar *compression = NULL;
+
+  /* The receiver supporting the probe advertises the compression it accepts. */
+  if (NNS_EDGE_ERROR_NONE == nns_edge_data_get_info (data_h,
+          "accept-compression", &compression)) {
+    g_atomic_int_set (&offloading_s->peer_compression,
+        g_str_equal (compression, "zlib"));
+  }
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "probe-id",
+          &probe_id) ||
+      NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "probe-result",
+          &result)) {
+    _ml_loge ("Failed to get the result of the content probe.");
+    return;
+  }
+
+  g_mutex_lock (&offloading_s->probe_lock);
+  if (g_hash_table_contains (offloading_s->probe_table, probe_id)) {
+    g_hash_table_insert (offloading_s->probe_table, g_strdup (probe_id),
+        GINT_TO_POINTER (g_str_equal (result, "hit") ? PROBE_HIT : PROBE_MISS));
+    g_cond_broadcast (&offloading_s->probe_cond);
+  }
+  g_mutex_unlock (&offloading_s->probe_lock);
+}
+
+/**
+ * @brief Invoke the reply event for each request coalesced in an edge message.
+ */
+static int
+_mlrs_invoke_coalesced_reply (ml_service_s * mls, nns_edge_data_h data_h)
+{
+  ml_service_event_cb_info_s cb_info = { 0 };
+  ml_information_h info_h = NULL;
+  unsigned int i, count = 0;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report_return (ret,
+        "Failed to get the number of coalesced requests.");
+  }
+
+  _ml_service_get_event_cb_info (mls, &cb_info);
+  if (!cb_info.cb)
+    return NNS_EDGE_ERROR_NONE;
+
+  for (i = 0; i < count; i++) {
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      break;
+
+    ret = _ml_information_create (&info_h);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report ("Failed to create information handle.");
+      break;
+    }
+
+    ret = _ml_information_set (info_h, "data", data, NULL);
+    if (ML_ERROR_NONE == ret)
+      cb_info.cb (ML_SERVICE_EVENT_REPLY, info_h, cb_info.pdata);
+
+    ml_information_destroy (info_h);
+    info_h = NULL;
+
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report ("Failed to set data information.");
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Get data from gievn uri
+ */
+static gboolean
+_mlrs_get_data_from_uri (gchar * uri, GByteArray * array)
+{
+  CURL *curl;
+  CURLcode res;
+  gboolean ret = FALSE;
+
+  curl = curl_easy_init ();
+  if (curl) {
+    if (CURLE_OK != curl_easy_setopt (curl, CURLOPT_URL, (gchar *) uri) ||
+        CURLE_OK != curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1L) ||
+        CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION,
+            curl_mem_write_cb) ||
+        CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEDATA,
+            (void *) array)) {
+      _ml_loge ("Failed to set option for curl easy handle.");
+      ret = FALSE;
+      goto done;
+    }
+
+    res = curl_easy_perform (curl);
+
+    if (res != CURLE_OK) {
+      _ml_loge ("curl_easy_perform failed: %s", curl_easy_strerror (res));
+      ret = FALSE;
+      goto done;
+    }
+
+    ret = TRUE;
+  }
+
+done:
+  if (curl)
+    curl_easy_cleanup (curl);
+  return ret;
+}
+
+/**
+ * @brief Callback function for writing the downloaded data to file using curl.
+ */
+static size_t
+curl_file_write_cb (void *data, size_t size, size_t nmemb, void *clientp)
+{
+  FILE *fp = (FILE *) clientp;
+
+  return fwrite (data, size, nmemb, fp) * size;
+}
+
+/**
+ * @brief Callback function for writing the downloaded range to file using curl.
+ */
+static size_t
+curl_range_write_cb (void *data, size_t size, size_t nmemb, void *clientp)
+{
+  _mlrs_http_range_s *range = (_mlrs_http_range_s *) clientp;
+  size_t recv_size = size * nmemb;
+  ssize_t written;
+
+  if (range->offset + recv_size > range->end + 1)
+    return 0;
+
+  written = pwrite (range->fd, data, recv_size, (off_t) range->offset);
+  if (written < 0 || (size_t) written != recv_size)
+    return 0;
+
+  range->offset += recv_size;
+  return recv_size;
+}
+
+/**
+ * @brief Callback function for parsing the response header using curl.
+ */
+static size_t
+curl_header_cb (char *buffer, size_t size, size_t nitems, void *clientp)
+{
+  _mlrs_http_meta_s *meta = (_mlrs_http_meta_s *) clientp;
+  size_t len = size * nitems;
+  g_autofree gchar *line = g_strndup (buffer, len);
+  gchar *value;
+
+  g_strstrip (line);
+
+  /* New response (e.g., redirected), reset the header values. */
+  if (g_ascii_strncasecmp (line, "HTTP/", 5) == 0) {
+    g_clear_pointer (&meta->etag, g_free);
+    g_clear_pointer (&meta->last_modified, g_free);
+    meta->accept_ranges = FALSE;
+    return len;
+  }
+
+  value = strchr (line, ':');
+  if (!value)
+    return len;
+
+  *value++ = '\0';
+  g_strstrip (value);
+
+  if (g_ascii_strcasecmp (line, "ETag") == 0) {
+    g_free (meta->etag);
+    meta->etag = g_strdup (value);
+  } else if (g_ascii_strcasecmp (line, "Last-Modified") == 0) {
+    g_free (meta->last_modified);
+    meta->last_modified = g_strdup (value);
+  } else if (g_ascii_strcasecmp (line, "Accept-Ranges") == 0) {
+    meta->accept_ranges = (g_ascii_strcasecmp (value, "bytes") == 0);
+  }
+
+  return len;
+}
+
+/**
+ * @brief Release the validator of the cached model file.
+ */
+static void
+_mlrs_http_meta_clear (_mlrs_http_meta_s * meta)
+{
+  g_clear_pointer (&meta->etag, g_free);
+  g_clear_pointer (&meta->last_modified, g_free);
+  meta->accept_ranges = FALSE;
+}
+
+/**
+ * @brief Request the model file from given uri. If the validator is given, the request is conditional.
+ * @param[in] uri The uri of the model file.
+ * @param[in] fp The file to write the response body. Set NULL to request the header only.
+ * @param[in] cached The validator of the cached model file, or NULL.
+ * @param[out] meta The validator and the header values of the response.
+ * @param[out] length The content length of the response.
+ * @return The response code, or -1 if failed to request.
+ */
+static glong
+_mlrs_http_request (const gchar * uri, FILE * fp,
+    const _mlrs_http_meta_s * cached, _mlrs_http_meta_s * meta,
+    curl_off_t * length)
+{
+  CURL *curl;
+  CURLcode res;
+  struct curl_slist *headers = NULL;
+  g_autofree gchar *if_none_match = NULL;
+  g_autofree gchar *if_modified_since = NULL;
+  glong code = -1;
+
+  curl = curl_easy_init ();
+  if (!curl) {
+    _ml_loge ("Failed to create curl easy handle.");
+    return -1;
+  }
+
+  if (cached && cached->etag) {
+    if_none_match = g_strdup_printf ("If-None-Match: %s", cached->etag);
+    headers = curl_slist_append (headers, if_none_match);
+  }
+
+  if (cached && cached->last_modified) {
+    if_modified_since = g_strdup_printf ("If-Modified-Since: %s",
+        cached->last_modified);
+    headers = curl_slist_append (headers, if_modified_since);
+  }
+
+  if (CURLE_OK != curl_easy_setopt (curl, CURLOPT_URL, uri) ||
+      CURLE_OK != curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1L) ||
+      CURLE_OK != curl_easy_setopt (curl, CURLOPT_FAILONERROR, 1L) ||
+      CURLE_OK != curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers) ||
+      CURLE_OK != curl_easy_setopt (curl, CURLOPT_HEADERFUNCTION,
+          curl_header_cb) ||
+      CURLE_OK != curl_easy_setopt (curl, CURLOPT_HEADERDATA, (void *) meta)) {
+    _ml_loge ("Failed to set option for curl easy handle.");
+    goto done;
+  }
+
+  if (fp) {
+    if (CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION,
+            curl_file_write_cb) ||
+        CURLE_OK != curl_easy_setopt (curl, CURLOPT_WRITEDATA, (void *) fp)) {
+      _ml_loge ("Failed to set option for curl easy handle.");
+      goto done;
+    }
+  } else {
+    if (CURLE_OK != curl_easy_setopt (curl, CURLOPT_NOBODY, 1L)) {
+      _ml_loge ("Failed to set option for curl easy handle.");
+      goto done;
+    }
+  }
+
+  res = curl_easy_perform (curl);
+  if (res != CURLE_OK) {
+    _ml_loge ("curl_easy_perform failed: %s", curl_easy_strerror (res));
+    goto done;
+  }
+
+  code = 0;
+  curl_easy_getinfo (curl, CURLINFO_RESPONSE_CODE, &code);
+
+  if (length) {
+    *length = -1;
+    curl_easy_getinfo (curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, length);
+  }
+
+done:
+  curl_slist_free_all (headers);
+  curl_easy_cleanup (curl);
+  return code;
+}
+
+/**
+ * @brief Download the model file with parallel range requests.
+ */
+static gboolean
+_mlrs_http_download_ranges (const gchar * uri, const gchar * file_path,
+    guint64 length, guint parallel)
+{
+  CURLM *multi;
+  CURL **curls;
+  CURLMsg *msg;
+  _mlrs_http_range_s *ranges;
+  gchar range_str[64];
+  guint64 part;
+  guint i;
+  int fd, running = 0, remains;
+  glong code;
+  gboolean ret = FALSE;
+
+  fd = g_open (file_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    _ml_loge ("Failed to open the file '%s': %s", file_path,
+        g_strerror (errno));
+    return FALSE;
+  }
+
+  multi = curl_multi_init ();
+  curls = g_new0 (CURL *, parallel);
+  ranges = g_new0 (_mlrs_http_range_s, parallel);
+  part = (length + parallel - 1) / parallel;
+
+  for (i = 0; i < parallel; i++) {
+    ranges[i].fd = fd;
+    ranges[i].offset = part * i;
+    ranges[i].end = MIN (part * (i + 1), length) - 1;
+
+    g_snprintf (range_str, sizeof (range_str),
+        "%" G_GUINT64_FORMAT "-%" G_GUINT64_FORMAT, ranges[i].offset,
+        ranges[i].end);
+
+    curls[i] = curl_easy_init ();
+    if (!curls[i] ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_URL, uri) ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_FOLLOWLOCATION, 1L) ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_FAILONERROR, 1L) ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_RANGE, range_str) ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_WRITEFUNCTION,
+            curl_range_write_cb) ||
+        CURLE_OK != curl_easy_setopt (curls[i], CURLOPT_WRITEDATA,
+            (void *) &ranges[i]) ||
+        CURLM_OK != curl_multi_add_handle (multi, curls[i])) {
+      _ml_loge ("Failed to prepare the range request.");
+      goto done;
+    }
+  }
+
+  do {
+    if (CURLM_OK != curl_multi_perform (multi, &running) ||
+        (running > 0 && CURLM_OK != curl_multi_wait (multi, NULL, 0, 1000,
+                NULL))) {
+      _ml_loge ("Failed to download the ranges of '%s'.", uri);
+      goto done;
+    }
+  } while (running > 0);
+
+  ret = TRUE;
+  while ((msg = curl_multi_info_read (multi, &remains))) {
+    if (msg->msg != CURLMSG_DONE)
+      continue;
+
+    code = 0;
+    curl_easy_getinfo (msg->easy_handle, CURLINFO_RESPONSE_CODE, &code);
+    if (msg->data.result != CURLE_OK || code != 206) {
+      _ml_loge ("Failed to download the range (code %ld): %s", code,
+          curl_easy_strerror (msg->data.result));
+      ret = FALSE;
+    }
+  }
+
+  /* Check all ranges are completely written. */
+  for (i = 0; i < parallel && ret; i++) {
+    if (ranges[i].offset != ranges[i].end + 1) {
+      _ml_loge ("The range %u of '%s' is incomplete.", i, uri);
+      ret = FALSE;
+    }
+  }
+
+  if (ret && fsync (fd) != 0)
+    ret = FALSE;
+
+done:
+  for (i = 0; i < parallel; i++) {
+    if (curls[i]) {
+      curl_multi_remove_handle (multi, curls[i]);
+      curl_easy_cleanup (curls[i]);
+    }
+  }
+
+  curl_multi_cleanup (multi);
+  g_free (curls);
+  g_free (ranges);
+  close (fd);
+  return ret;
+}
+
+/**
+ * @brief Download the model file with single request and write it to the file.
+ */
+static glong
+_mlrs_http_download (const gchar * uri, const gchar * file_path,
+    const _mlrs_http_meta_s * cached, _mlrs_http_meta_s * meta)
+{
+  FILE *fp;
+  glong code;
+
+  fp = g_fopen (file_path, "wb");
+  if (!fp) {
+    _ml_loge ("Failed to open the file '%s': %s", file_path,
+        g_strerror (errno));
+    return -1;
+  }
+
+  code = _mlrs_http_request (uri, fp, cached, meta, NULL);
+
+  if (fflush (fp) != 0 || fsync (fileno (fp)) != 0)
+    code = -1;
+
+  fclose (fp);
+  return code;
+}
+
+/**
+ * @brief Create the unique temporary file to download the model file, in the same directory as the target file.
+ * The concurrent downloads of the same file do not write the same temporary file.
+ * @note The caller is responsible for freeing the returned data using g_free().
+ */
+static gchar *
+_mlrs_create_download_file (const gchar * target)
+{
+  gchar *tmp_file;
+  int fd;
+
+  tmp_file = g_strdup_printf ("%s.download.XXXXXX", target);
+  fd = g_mkstemp (tmp_file);
+  if (fd < 0) {
+    _ml_loge ("Failed to create the temporary file to download '%s': %s",
+        target, g_strerror (errno));
+    g_free (tmp_file);
+    return NULL;
+  }
+
+  /* The model file is shared with ml-agent and other processes. */
+  fchmod (fd, 0644);
+  close (fd);
+
+  return tmp_file;
+}
+
+/**
+ * @brief Download the model file from given uri and save it to the model path.
+ * The response is written to the file directly. The model file from http(s) is cached with its validator (ETag and Last-Modified), and the unchanged model is not downloaded again.
+ */
+static gboolean
+_mlrs_download_model (_ml_service_offloading_s * offloading_s,
+    const gchar * uri, const gchar * model_path)
+{
+  g_autofree gchar *hash = NULL;
+  g_autofree gchar *cache_file = NULL;
+  g_autofree gchar *meta_file = NULL;
+  g_autofree gchar *tmp_file = NULL;
+  g_autoptr (GKeyFile) key_file = NULL;
+  _mlrs_http_meta_s cached = { 0 };
+  _mlrs_http_meta_s meta = { 0 };
+  curl_off_t length = -1;
+  gboolean is_http, ret = FALSE;
+  glong code;
+
+  is_http = (g_ascii_strncasecmp (uri, "http://", 7) == 0 ||
+      g_ascii_strncasecmp (uri, "https://", 8) == 0);
+
+  if (!is_http || !offloading_s->cache_dir ||
+      g_mkdir_with_parents (offloading_s->cache_dir, 0755) < 0) {
+    /* No cache, write the response to the temporary file and replace the model file. */
+    tmp_file = _mlrs_create_download_file (model_path);
+    if (!tmp_file)
+      return FALSE;
+
+    code = _mlrs_http_download (uri, tmp_file, NULL, &meta);
+    _mlrs_http_meta_clear (&meta);
+
+    /* The response code is 0 if the uri is not http(s), e.g., file. */
+    if (code < 0 || (is_http && (code < 200 || code >= 300))) {
+      _ml_loge ("Failed to download the model file from '%s' (code %ld).",
+          uri, code);
+      g_remove (tmp_file);
+      return FALSE;
+    }
+
+    if (g_rename (tmp_file, model_path) != 0) {
+      g_remove (tmp_file);
+      return FALSE;
+    }
+
+    return TRUE;
+  }
+
+  hash = g_compute_checksum_for_string (G_CHECKSUM_SHA256, uri, -1);
+  cache_file = g_build_filename (offloading_s->cache_dir, hash, NULL);
+  meta_file = g_strdup_printf ("%s.meta", cache_file);
+
+  key_file = g_key_file_new ();
+  if (g_file_test (cache_file, G_FILE_TEST_IS_REGULAR) &&
+      g_key_file_load_from_file (key_file, meta_file, G_KEY_FILE_NONE, NULL)) {
+    cached.etag = g_key_file_get_string (key_file, "cache", "etag", NULL);
+    cached.last_modified =
+        g_key_file_get_string (key_file, "cache", "last-modified", NULL);
+  }
+
+  /* Revalidate the cached file and get the length of the model file. */
+  code = _mlrs_http_request (uri, NULL, &cached, &meta, &length);
+
+  if (code == 304) {
+    _ml_logi ("The model file from '%s' is not modified, use the cached file.",
+        uri);
+    goto install;
+  }
+
+  /* The other receiver may download the same uri into the cache directory, write the unique file and rename it. */
+  tmp_file = _mlrs_create_download_file (cache_file);
+  if (!tmp_file)
+    goto done;
+
+  if (code == 200 && meta.accept_ranges && length >= MIN_PARALLEL_DOWNLOAD_SIZE
+      && offloading_s->download_parallel > 1) {
+    if (_mlrs_http_download_ranges (uri, tmp_file, (guint64) length,
+            offloading_s->download_parallel))
+      goto save;
+
+    _ml_logw ("Failed to download the ranges of '%s', download the whole file.",
+        uri);
+  }
+
+  /* Conditional GET, the server may not support HEAD request. */
+  _mlrs_http_meta_clear (&meta);
+  code = _mlrs_http_download (uri, tmp_file, &cached, &meta);
+
+  if (code == 304) {
+    g_remove (tmp_file);
+    goto install;
+  }
+
+  if (code != 200) {
+    _ml_loge ("Failed to download the model file from '%s' (code %ld).", uri,
+        code);
+    g_remove (tmp_file);
+    goto done;
+  }
+
+save:
+  if (g_rename (tmp_file, cache_file) != 0) {
+    _ml_loge ("Failed to rename the file '%s': %s", tmp_file,
+        g_strerror (errno));
+    g_remove (tmp_file);
+    goto done;
+  }
+
+  g_key_file_remove_group (key_file, "cache", NULL);
+  g_key_file_set_string (key_file, "cache", "uri", uri);
+  if (meta.etag)
+    g_key_file_set_string (key_file, "cache", "etag", meta.etag);
+  if (meta.last_modified)
+    g_key_file_set_string (key_file, "cache", "last-modified",
+        meta.last_modified);
+
+  if (!g_key_file_save_to_file (key_file, meta_file, NULL))
+    _ml_logw ("Failed to save the validator of the cached model file.");
+
+install:
+  ret = _mlrs_install_file (cache_file, model_path);
+
+done:
+  _mlrs_http_meta_clear (&cached);
+  _mlrs_http_meta_clear (&meta);
+  return ret;
+}
+
+/**
+ * @brief Process ml offloading service
+ */
+static int
+_mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
 {
   void *data;
   nns_size_t data_len;
   g_autofree gchar *service_str = NULL;
   g_autofree gchar *service_key = NULL;
   g_autofree gchar *dir_path = NULL;
+  g_autoptr (GByteArray) decompressed = NULL;
+  g_autoptr (GByteArray) patched = NULL;
   ml_service_offloading_type_e service_type;
   int ret = NNS_EDGE_ERROR_NONE;
   ml_service_s *mls = (ml_service_s *) user_data;
@@ -372,7 +2041,23 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
     _ml_error_report_return (ret,
         "Failed to get service type while processing the ml-offloading service.");
   }
-  service_type = _mlrs_get_service_type (service_str);
+
+  if (g_str_equal (service_str, CONTENT_PROBE_REPLY)) {
+    _mlrs_process_content_probe_reply (offloading_s, data_h);
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  /* The chunk is decompressed one by one, so the memory is bounded by the chunk size. */
+  decompressed = _mlrs_decompress (offloading_s, data_h, data, data_len, &ret);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report_return (ret,
+        "Failed to decompress data while processing the ml-offloading service.");
+  }
+
+  if (decompressed) {
+    data = decompressed->data;
+    data_len = decompressed->len;
+  }
 
   ret = nns_edge_data_get_info (data_h, "service-key", &service_key);
   if (NNS_EDGE_ERROR_NONE != ret) {
@@ -382,6 +2067,27 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
 
   dir_path = _mlrs_get_model_dir_path (offloading_s, service_key);
 
+  /* The model is sent as the delta against the base model. */
+  patched = _mlrs_apply_delta (offloading_s, data_h, dir_path, data, data_len,
+      &ret);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report_return (ret,
+        "Failed to apply the delta while processing the ml-offloading service.");
+  }
+
+  if (patched) {
+    data = patched->data;
+    data_len = patched->len;
+  }
+
+  if (g_str_equal (service_str, CONTENT_PROBE)) {
+    ret = _mlrs_process_content_probe (offloading_s, data_h, service_key,
+        dir_path, &event_type);
+    goto invoke_event;
+  }
+
+  service_type = _mlrs_get_service_type (service_str);
+
   if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
     ret = _ml_service_training_offloading_process_received_data (mls, data_h,
         dir_path, data, service_type);
@@ -406,39 +2112,63 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
   switch (service_type) {
     case ML_SERVICE_OFFLOADING_TYPE_MODEL_URI:
     {
-      GByteArray *array;
+      g_autofree gchar *name = NULL;
+      g_autofree gchar *model_path = NULL;
 
       if (!dir_path) {
         _ml_error_report_return (NNS_EDGE_ERROR_UNKNOWN,
             "Failed to get model directory path.");
       }
 
-      array = g_byte_array_new ();
+      if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "name", &name)) {
+        _ml_error_report_return (NNS_EDGE_ERROR_INVALID_PARAMETER,
+            "Failed to get name while processing the ml-offloading service.");
+      }
 
-      if (!_mlrs_get_data_from_uri ((gchar *) data, array)) {
-        g_byte_array_free (array, TRUE);
+      model_path = g_build_path (G_DIR_SEPARATOR_S, dir_path, name, NULL);
+
+      if (!_mlrs_download_model (offloading_s, (gchar *) data, model_path)) {
         _ml_error_report_return (NNS_EDGE_ERROR_IO,
             "Failed to get data from uri: %s.", (gchar *) data);
       }
 
-      if (_mlrs_model_register (service_key, data_h, array->data, array->len,
-              dir_path)) {
+      if (_mlrs_model_register_path (service_key, data_h, model_path)) {
         event_type = ML_SERVICE_EVENT_MODEL_REGISTERED;
       } else {
         _ml_error_report ("Failed to register model downloaded from: %s.",
             (gchar *) data);
         ret = NNS_EDGE_ERROR_UNKNOWN;
       }
-      g_byte_array_free (array, TRUE);
       break;
     }
     case ML_SERVICE_OFFLOADING_TYPE_MODEL_RAW:
     {
+      g_autofree gchar *transfer_id = NULL;
+
       if (!dir_path) {
         _ml_error_report_return (NNS_EDGE_ERROR_UNKNOWN,
             "Failed to get model directory path.");
       }
 
+      if (NNS_EDGE_ERROR_NONE == nns_edge_data_get_info (data_h, "transfer-id",
+              &transfer_id)) {
+        g_autofree gchar *model_path = NULL;
+
+        /* The model file is sent in chunks, register it with the last chunk. */
+        ret = _mlrs_model_receive_chunk (offloading_s, data_h, data, data_len,
+            dir_path, transfer_id, &model_path);
+        if (NNS_EDGE_ERROR_NONE != ret || !model_path)
+          break;
+
+        if (_mlrs_model_register_path (service_key, data_h, model_path)) {
+          event_type = ML_SERVICE_EVENT_MODEL_REGISTERED;
+        } else {
+          _ml_error_report ("Failed to register model received in chunks.");
+          ret = NNS_EDGE_ERROR_UNKNOWN;
+        }
+        break;
+      }
+
       if (_mlrs_model_register (service_key, data_h, data, data_len, dir_path)) {
         event_type = ML_SERVICE_EVENT_MODEL_REGISTERED;
       } else {
@@ -452,10 +2182,9 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
     {
       GByteArray *array = g_byte_array_new ();
 
-      ret = _mlrs_get_data_from_uri ((gchar *) data, array);
-      if (!ret) {
+      if (!_mlrs_get_data_from_uri ((gchar *) data, array)) {
         g_byte_array_free (array, TRUE);
-        _ml_error_report_return (ret,
+        _ml_error_report_return (NNS_EDGE_ERROR_IO,
             "Failed to get data from uri: %s.", (gchar *) data);
       }
       ret = ml_service_pipeline_set (service_key, (gchar *) array->data);
@@ -473,6 +2202,15 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
       break;
     case ML_SERVICE_OFFLOADING_TYPE_REPLY:
     {
+      g_autofree gchar *coalesced = NULL;
+
+      if (NNS_EDGE_ERROR_NONE == nns_edge_data_get_info (data_h, "coalesced",
+              &coalesced)) {
+        /* Several requests are sent in an edge message, invoke the event for each. */
+        ret = _mlrs_invoke_coalesced_reply (mls, data_h);
+        break;
+      }
+
       ret = _ml_information_create (&info_h);
       if (ML_ERROR_NONE != ret) {
         _ml_error_report ("Failed to create information handle.");
@@ -490,61 +2228,211 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
     {
       ml_service_h service_h = NULL;
 
-      /**
-       * @todo Check privilege and availability here.
-       */
+      /**
+       * @todo Check privilege and availability here.
+       */
+
+      /* Hold the lock until the pipeline is inserted, not to launch the same pipeline twice. */
+      g_mutex_lock (&offloading_s->service_lock);
+      service_h =
+          g_hash_table_lookup (offloading_s->service_table, service_key);
+      if (service_h) {
+        g_mutex_unlock (&offloading_s->service_lock);
+        _ml_logi ("The registered service as key %s is already launched.",
+            service_key);
+        break;
+      }
+
+      ret = ml_service_pipeline_launch (service_key, &service_h);
+      if (ret != ML_ERROR_NONE) {
+        g_mutex_unlock (&offloading_s->service_lock);
+        _ml_error_report
+            ("Failed to launch the registered pipeline. service key: %s",
+            service_key);
+        goto done;
+      }
+      ret = ml_service_start (service_h);
+      if (ret != ML_ERROR_NONE) {
+        g_mutex_unlock (&offloading_s->service_lock);
+        _ml_error_report
+            ("Failed to start the registered pipeline. service key: %s",
+            service_key);
+        ml_service_destroy (service_h);
+        goto done;
+      }
+
+      g_hash_table_insert (offloading_s->service_table, g_strdup (service_key),
+          service_h);
+      g_mutex_unlock (&offloading_s->service_lock);
+      event_type = ML_SERVICE_EVENT_LAUNCH;
+      break;
+    }
+    default:
+      _ml_error_report ("Unknown service type '%d' or not supported yet.",
+          service_type);
+      break;
+  }
+
+invoke_event:
+  if (event_type != ML_SERVICE_EVENT_UNKNOWN) {
+    ml_service_event_cb_info_s cb_info = { 0 };
+
+    _ml_service_get_event_cb_info (mls, &cb_info);
+
+    if (cb_info.cb) {
+      cb_info.cb (event_type, info_h, cb_info.pdata);
+    }
+  }
+
+done:
+  if (info_h) {
+    ml_information_destroy (info_h);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Process the received data and update the statistics of the processing time.
+ */
+static int
+_mlrs_process_and_record (ml_service_s * mls, nns_edge_data_h data_h)
+{
+  _ml_service_offloading_s *offloading_s =
+      (_ml_service_offloading_s *) mls->priv;
+  _mlrs_process_stats_s *stats;
+  g_autofree gchar *service_str = NULL;
+  gint64 start_time;
+  guint64 elapsed;
+  int ret;
+
+  start_time = g_get_monotonic_time ();
+  ret = _mlrs_process_service_offloading (data_h, mls);
+  elapsed = (guint64) (g_get_monotonic_time () - start_time);
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "service-type",
+          &service_str))
+    return ret;
+
+  g_mutex_lock (&offloading_s->stats_lock);
+  stats = g_hash_table_lookup (offloading_s->process_stats, service_str);
+  if (!stats) {
+    stats = g_new0 (_mlrs_process_stats_s, 1);
+    g_hash_table_insert (offloading_s->process_stats,
+        g_steal_pointer (&service_str), stats);
+  }
+
+  stats->count++;
+  stats->total += elapsed;
+  stats->max = MAX (stats->max, elapsed);
+  g_mutex_unlock (&offloading_s->stats_lock);
+
+  return ret;
+}
+
+/**
+ * @brief Release the received data waiting to be processed.
+ */
+static void
+_mlrs_worker_queue_free (gpointer data)
+{
+  GQueue *queue = (GQueue *) data;
+  nns_edge_data_h data_h;
+
+  while ((data_h = g_queue_pop_head (queue)) != NULL)
+    nns_edge_data_destroy (data_h);
+
+  g_queue_free (queue);
+}
+
+/**
+ * @brief Worker to process the received data of a service key in order.
+ */
+static void
+_mlrs_worker_func (gpointer data, gpointer user_data)
+{
+  gchar *key = (gchar *) data;
+  ml_service_s *mls = (ml_service_s *) user_data;
+  _ml_service_offloading_s *offloading_s =
+      (_ml_service_offloading_s *) mls->priv;
+  GQueue *queue;
+  nns_edge_data_h data_h;
+
+  g_mutex_lock (&offloading_s->worker_lock);
+  while (!offloading_s->worker_stopping) {
+    queue = g_hash_table_lookup (offloading_s->worker_queues, key);
+    data_h = queue ? g_queue_pop_head (queue) : NULL;
+    if (!data_h)
+      break;
+
+    offloading_s->queue_depth--;
+    g_mutex_unlock (&offloading_s->worker_lock);
 
-      service_h =
-          g_hash_table_lookup (offloading_s->service_table, service_key);
-      if (service_h) {
-        _ml_logi ("The registered service as key %s is already launched.",
-            service_key);
-        break;
-      }
+    _mlrs_process_and_record (mls, data_h);
+    nns_edge_data_destroy (data_h);
 
-      ret = ml_service_pipeline_launch (service_key, &service_h);
-      if (ret != ML_ERROR_NONE) {
-        _ml_error_report
-            ("Failed to launch the registered pipeline. service key: %s",
-            service_key);
-        goto done;
-      }
-      ret = ml_service_start (service_h);
-      if (ret != ML_ERROR_NONE) {
-        _ml_error_report
-            ("Failed to start the registered pipeline. service key: %s",
-            service_key);
-        ml_service_destroy (service_h);
-        goto done;
-      }
+    g_mutex_lock (&offloading_s->worker_lock);
+  }
 
-      g_hash_table_insert (offloading_s->service_table, g_strdup (service_key),
-          service_h);
-      event_type = ML_SERVICE_EVENT_LAUNCH;
-      break;
-    }
-    default:
-      _ml_error_report ("Unknown service type '%d' or not supported yet.",
-          service_type);
-      break;
+  /* The next data of the key is queued with new task. */
+  queue = g_hash_table_lookup (offloading_s->worker_queues, key);
+  if (queue) {
+    offloading_s->queue_depth -= g_queue_get_length (queue);
+    g_hash_table_remove (offloading_s->worker_queues, key);
   }
+  g_mutex_unlock (&offloading_s->worker_lock);
 
-  if (event_type != ML_SERVICE_EVENT_UNKNOWN) {
-    ml_service_event_cb_info_s cb_info = { 0 };
+  g_free (key);
+}
 
-    _ml_service_get_event_cb_info (mls, &cb_info);
+/**
+ * @brief Queue the received data to be processed by the worker, not to block the edge connection.
+ * The data of the same service key is processed in order. All data is processed in order on training offloading, because the pipeline should be processed after the files.
+ * @return TRUE if the data is queued.
+ */
+static gboolean
+_mlrs_queue_service_offloading (ml_service_s * mls, nns_edge_data_h data_h)
+{
+  _ml_service_offloading_s *offloading_s =
+      (_ml_service_offloading_s *) mls->priv;
+  g_autofree gchar *service_str = NULL;
+  g_autofree gchar *service_key = NULL;
+  GQueue *queue;
+  gboolean queued = FALSE;
 
-    if (cb_info.cb) {
-      cb_info.cb (event_type, info_h, cb_info.pdata);
-    }
+  /* The reply of content probe is processed immediately, the sender is waiting for it. */
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "service-type",
+          &service_str) || g_str_equal (service_str, CONTENT_PROBE_REPLY))
+    return FALSE;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_data_get_info (data_h, "service-key",
+          &service_key))
+    return FALSE;
+
+  if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
+    g_free (service_key);
+    service_key = g_strdup ("");
   }
 
-done:
-  if (info_h) {
-    ml_information_destroy (info_h);
+  g_mutex_lock (&offloading_s->worker_lock);
+  if (!offloading_s->worker_stopping && offloading_s->workers > 0 &&
+      offloading_s->worker_pool) {
+    queue = g_hash_table_lookup (offloading_s->worker_queues, service_key);
+    if (!queue) {
+      queue = g_queue_new ();
+      g_hash_table_insert (offloading_s->worker_queues,
+          g_strdup (service_key), queue);
+      g_thread_pool_push (offloading_s->worker_pool, g_strdup (service_key),
+          NULL);
+    }
+
+    g_queue_push_tail (queue, data_h);
+    offloading_s->queue_depth++;
+    queued = TRUE;
   }
+  g_mutex_unlock (&offloading_s->worker_lock);
 
-  return ret;
+  return queued;
 }
 
 /**
@@ -568,7 +2456,13 @@ _mlrs_edge_event_cb (nns_edge_event_h event_h, void *user_data)
       if (NNS_EDGE_ERROR_NONE != ret)
         return ret;
 
-      ret = _mlrs_process_service_offloading (data_h, user_data);
+      /* The worker releases the queued data. */
+      if (_mlrs_queue_service_offloading ((ml_service_s *) user_data, data_h)) {
+        data_h = NULL;
+        break;
+      }
+
+      ret = _mlrs_process_and_record ((ml_service_s *) user_data, data_h);
       break;
     }
     default:
@@ -701,6 +2595,23 @@ _ml_service_offloading_release_internal (ml_service_s * mls)
 
   offloading_s = (_ml_service_offloading_s *) mls->priv;
 
+  /**
+   * Wait for the workers processing the data, and drop the queued data.
+   * The worker may use the training handle and send the data with edge handle, stop the workers first.
+   */
+  if (offloading_s->worker_pool) {
+    g_mutex_lock (&offloading_s->worker_lock);
+    offloading_s->worker_stopping = TRUE;
+    g_mutex_unlock (&offloading_s->worker_lock);
+
+    g_thread_pool_free (offloading_s->worker_pool, FALSE, TRUE);
+    offloading_s->worker_pool = NULL;
+  }
+
+  /* The model files may be deleted while running, remove the blobs left without model file. */
+  if (offloading_s->path)
+    _mlrs_blob_release (offloading_s->path);
+
   if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
     /**
      * '_ml_service_training_offloading_destroy' transfers internally trained models.
@@ -712,67 +2623,433 @@ _ml_service_offloading_release_internal (ml_service_s * mls)
     }
   }
 
-  if (offloading_s->edge_h) {
-    nns_edge_release_handle (offloading_s->edge_h);
-    offloading_s->edge_h = NULL;
+  /* Send the coalesced requests before releasing edge handle. */
+  if (offloading_s->coalesce_thread) {
+    g_mutex_lock (&offloading_s->coalesce_lock);
+    offloading_s->coalesce_running = FALSE;
+    g_cond_broadcast (&offloading_s->coalesce_cond);
+    g_mutex_unlock (&offloading_s->coalesce_lock);
+
+    g_thread_join (offloading_s->coalesce_thread);
+    offloading_s->coalesce_thread = NULL;
+  }
+
+  if (offloading_s->edge_h) {
+    nns_edge_release_handle (offloading_s->edge_h);
+    offloading_s->edge_h = NULL;
+  }
+
+  if (offloading_s->worker_queues) {
+    g_hash_table_destroy (offloading_s->worker_queues);
+    offloading_s->worker_queues = NULL;
+  }
+
+  if (offloading_s->process_stats) {
+    g_hash_table_destroy (offloading_s->process_stats);
+    offloading_s->process_stats = NULL;
+  }
+
+  if (offloading_s->option_table) {
+    g_hash_table_destroy (offloading_s->option_table);
+    offloading_s->option_table = NULL;
+  }
+
+  if (offloading_s->service_table) {
+    g_hash_table_destroy (offloading_s->service_table);
+    offloading_s->service_table = NULL;
+  }
+  g_mutex_clear (&offloading_s->service_lock);
+
+  if (offloading_s->transfer_table) {
+    g_hash_table_destroy (offloading_s->transfer_table);
+    offloading_s->transfer_table = NULL;
+  }
+
+  if (offloading_s->sent_files) {
+    g_hash_table_destroy (offloading_s->sent_files);
+    offloading_s->sent_files = NULL;
+  }
+
+  if (offloading_s->probe_table) {
+    g_hash_table_destroy (offloading_s->probe_table);
+    offloading_s->probe_table = NULL;
+  }
+
+  if (offloading_s->template_table) {
+    g_hash_table_destroy (offloading_s->template_table);
+    offloading_s->template_table = NULL;
+  }
+
+  g_mutex_clear (&offloading_s->transfer_lock);
+  g_cond_clear (&offloading_s->transfer_cond);
+  g_mutex_clear (&offloading_s->probe_lock);
+  g_mutex_clear (&offloading_s->stats_lock);
+  g_mutex_clear (&offloading_s->coalesce_lock);
+  g_mutex_clear (&offloading_s->worker_lock);
+  g_cond_clear (&offloading_s->coalesce_cond);
+  g_cond_clear (&offloading_s->probe_cond);
+  g_free (offloading_s->cache_dir);
+  g_free (offloading_s->path);
+  g_free (offloading_s);
+  mls->priv = NULL;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Set value in ml-service offloading handle.
+ */
+int
+_ml_service_offloading_set_information (ml_service_h handle, const gchar * name,
+    const gchar * value)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  _ml_service_offloading_s *offloading_s;
+  int ret = ML_ERROR_NONE;
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  if (g_ascii_strcasecmp (name, "path") == 0) {
+    if (!g_file_test (value, G_FILE_TEST_IS_DIR)) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, dir path '%s' is invalid or the dir is not found or accessible.",
+          value);
+    }
+
+    if (g_access (value, W_OK) != 0) {
+      _ml_error_report_return (ML_ERROR_PERMISSION_DENIED,
+          "Write permission to dir '%s' is denied.", value);
+    }
+
+    g_free (offloading_s->path);
+    offloading_s->path = g_strdup (value);
+
+    if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
+      ret = _ml_service_training_offloading_set_path (mls, offloading_s->path);
+    }
+  } else if (g_ascii_strcasecmp (name, "chunk-size") == 0) {
+    gchar *endptr = NULL;
+    guint64 size = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || size > G_MAXSIZE) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, chunk size '%s' is invalid.", value);
+    }
+
+    offloading_s->chunk_size = (gsize) size;
+  } else if (g_ascii_strcasecmp (name, "cache-dir") == 0) {
+    g_free (offloading_s->cache_dir);
+    offloading_s->cache_dir = g_strdup (value);
+  } else if (g_ascii_strcasecmp (name, "download-parallel") == 0) {
+    gchar *endptr = NULL;
+    guint64 parallel = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || parallel == 0 || parallel > 16) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, the number of parallel download '%s' is invalid. It should be 1 to 16.",
+          value);
+    }
+
+    offloading_s->download_parallel = (guint) parallel;
+  } else if (g_ascii_strcasecmp (name, "dedup-timeout") == 0) {
+    gchar *endptr = NULL;
+    guint64 timeout = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || timeout > G_MAXUINT) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, dedup timeout '%s' is invalid.", value);
+    }
+
+    offloading_s->dedup_timeout = (guint) timeout;
+  } else if (g_ascii_strcasecmp (name, "compression") == 0) {
+    if (g_ascii_strcasecmp (value, "none") == 0) {
+      offloading_s->compression = COMPRESSION_NONE;
+    } else if (g_ascii_strcasecmp (value, "zlib") == 0) {
+      offloading_s->compression = COMPRESSION_ZLIB;
+    } else if (g_ascii_strcasecmp (value, "auto") == 0) {
+      offloading_s->compression = COMPRESSION_AUTO;
+    } else {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, compression '%s' is invalid. It should be one of none, zlib and auto.",
+          value);
+    }
+  } else if (g_ascii_strcasecmp (name, "max-raw-size") == 0) {
+    gchar *endptr = NULL;
+    guint64 size = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || size == 0 || size > G_MAXUINT) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, max raw size '%s' is invalid.", value);
+    }
+
+    offloading_s->max_raw_size = (gsize) size;
+  } else if (g_ascii_strcasecmp (name, "coalesce") == 0) {
+    gchar *endptr = NULL;
+    guint64 coalesce = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || coalesce == 0 ||
+        coalesce > MAX_COALESCE) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, the number of coalesced requests '%s' is invalid. It should be 1 to %u.",
+          value, MAX_COALESCE);
+    }
+
+    offloading_s->coalesce = (guint) coalesce;
+  } else if (g_ascii_strcasecmp (name, "coalesce-interval") == 0) {
+    gchar *endptr = NULL;
+    guint64 interval = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || interval == 0 ||
+        interval > G_MAXUINT) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, coalesce interval '%s' is invalid.", value);
+    }
+
+    if (offloading_s->coalesce_thread) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The coalesce interval cannot be changed after sending the coalesced request.");
+    }
+
+    offloading_s->coalesce_interval = (guint) interval;
+  } else if (g_ascii_strcasecmp (name, "workers") == 0) {
+    gchar *endptr = NULL;
+    guint64 workers = g_ascii_strtoull (value, &endptr, 10);
+
+    if (endptr == value || *endptr != '\0' || workers > MAX_WORKERS) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, the number of workers '%s' is invalid. It should be 0 to %u.",
+          value, MAX_WORKERS);
+    }
+
+    g_mutex_lock (&offloading_s->worker_lock);
+    /* The worker pool is created when the workers are required. */
+    if (workers > 0 && !offloading_s->worker_pool) {
+      offloading_s->worker_pool = g_thread_pool_new (_mlrs_worker_func, mls,
+          (gint) workers, FALSE, NULL);
+      if (!offloading_s->worker_pool)
+        ret = ML_ERROR_OUT_OF_MEMORY;
+    } else if (workers > 0 &&
+        !g_thread_pool_set_max_threads (offloading_s->worker_pool,
+            (gint) workers, NULL)) {
+      ret = ML_ERROR_STREAMS_PIPE;
+    }
+
+    if (ML_ERROR_NONE == ret)
+      offloading_s->workers = (guint) workers;
+    g_mutex_unlock (&offloading_s->worker_lock);
+
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret, "Failed to set the number of workers.");
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to get the runtime information of ml-service offloading.
+ */
+int
+_ml_service_offloading_get_information (ml_service_s * mls, const gchar * name,
+    gchar ** value)
+{
+  _ml_service_offloading_s *offloading_s;
+  int ret = ML_ERROR_NONE;
+
+  if (!mls || !mls->priv || !name || !value)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  g_mutex_lock (&offloading_s->stats_lock);
+  if (g_ascii_strcasecmp (name, "compression_count") == 0) {
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT,
+        offloading_s->compress_count);
+  } else if (g_ascii_strcasecmp (name, "compression_ratio") == 0) {
+    /* The ratio of the original size to the compressed size. */
+    *value = g_strdup_printf ("%.3f", offloading_s->compress_bytes > 0 ?
+        (gdouble) offloading_s->compress_raw_bytes /
+        offloading_s->compress_bytes : 1.0);
+  } else if (g_ascii_strcasecmp (name, "compression_time") == 0) {
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT,
+        offloading_s->compress_time);
+  } else if (g_ascii_strcasecmp (name, "decompression_count") == 0) {
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT,
+        offloading_s->decompress_count);
+  } else if (g_ascii_strcasecmp (name, "decompression_time") == 0) {
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT,
+        offloading_s->decompress_time);
+  } else if (g_str_has_prefix (name, "processed_")) {
+    _mlrs_process_stats_s *stats = g_hash_table_lookup
+        (offloading_s->process_stats, name + strlen ("processed_"));
+
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT, stats ? stats->count : 0);
+  } else if (g_str_has_prefix (name, "processing_time_avg_")) {
+    _mlrs_process_stats_s *stats = g_hash_table_lookup
+        (offloading_s->process_stats, name + strlen ("processing_time_avg_"));
+
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT, (stats && stats->count) ?
+        stats->total / stats->count : 0);
+  } else if (g_str_has_prefix (name, "processing_time_max_")) {
+    _mlrs_process_stats_s *stats = g_hash_table_lookup
+        (offloading_s->process_stats, name + strlen ("processing_time_max_"));
+
+    *value = g_strdup_printf ("%" G_GUINT64_FORMAT, stats ? stats->max : 0);
+  } else if (g_ascii_strcasecmp (name, "queue_depth") != 0) {
+    ret = ML_ERROR_INVALID_PARAMETER;
+  }
+  g_mutex_unlock (&offloading_s->stats_lock);
+
+  if (g_ascii_strcasecmp (name, "queue_depth") == 0) {
+    g_mutex_lock (&offloading_s->worker_lock);
+    *value = g_strdup_printf ("%u", offloading_s->queue_depth);
+    g_mutex_unlock (&offloading_s->worker_lock);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to build edge data with the information of the service.
+ */
+static int
+_mlrs_build_edge_data (JsonObject * service_obj, nns_edge_data_h * data)
+{
+  nns_edge_data_h data_h = NULL;
+  int ret = NNS_EDGE_ERROR_NONE;
+  const gchar *service_str = NULL;
+  const gchar *service_key = NULL;
+  const gchar *description = NULL;
+  const gchar *name = NULL;
+  const gchar *activate = NULL;
+
+  service_str =
+      _ml_service_get_json_string_member (service_obj, "service-type");
+  if (!service_str) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to get service type from the json object.");
+  }
+
+  service_key = _ml_service_get_json_string_member (service_obj, "service-key");
+  if (!service_key) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to get service key from the json object.");
+  }
+
+  ret = nns_edge_data_create (&data_h);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report ("Failed to create an edge data.");
+    return ret;
+  }
+
+  ret = nns_edge_data_set_info (data_h, "service-type", service_str);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report ("Failed to set service type in edge data.");
+    goto done;
+  }
+  ret = nns_edge_data_set_info (data_h, "service-key", service_key);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report ("Failed to set service key in edge data.");
+    goto done;
+  }
+
+  description = _ml_service_get_json_string_member (service_obj, "description");
+  if (description) {
+    ret = nns_edge_data_set_info (data_h, "description", description);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      _ml_logi ("Failed to set description in edge data.");
+    }
+  }
+
+  name = _ml_service_get_json_string_member (service_obj, "name");
+  if (name) {
+    ret = nns_edge_data_set_info (data_h, "name", name);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      _ml_logi ("Failed to set name in edge data.");
+    }
   }
 
-  if (offloading_s->option_table) {
-    g_hash_table_destroy (offloading_s->option_table);
-    offloading_s->option_table = NULL;
+  activate = _ml_service_get_json_string_member (service_obj, "activate");
+  if (activate) {
+    ret = nns_edge_data_set_info (data_h, "activate", activate);
+    if (NNS_EDGE_ERROR_NONE != ret) {
+      _ml_logi ("Failed to set activate in edge data.");
+    }
   }
 
-  if (offloading_s->service_table) {
-    g_hash_table_destroy (offloading_s->service_table);
-    offloading_s->service_table = NULL;
+  ret = NNS_EDGE_ERROR_NONE;
+
+done:
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_data_destroy (data_h);
+    data_h = NULL;
   }
 
-  g_free (offloading_s->path);
-  g_free (offloading_s);
-  mls->priv = NULL;
+  *data = data_h;
+  return ret;
+}
 
-  return ML_ERROR_NONE;
+/**
+ * @brief Internal function to release the template of the service.
+ */
+static void
+_mlrs_service_template_free (gpointer data)
+{
+  _mlrs_service_template_s *tmpl = (_mlrs_service_template_s *) data;
+
+  if (!tmpl)
+    return;
+
+  if (tmpl->pending)
+    nns_edge_data_destroy (tmpl->pending);
+  if (tmpl->data_h)
+    nns_edge_data_destroy (tmpl->data_h);
+  if (tmpl->node)
+    json_node_unref (tmpl->node);
+  g_free (tmpl);
 }
 
 /**
- * @brief Set value in ml-service offloading handle.
+ * @brief Internal function to compile the service into the template of edge data.
  */
-int
-_ml_service_offloading_set_information (ml_service_h handle, const gchar * name,
-    const gchar * value)
+static int
+_mlrs_service_template_new (const gchar * value,
+    _mlrs_service_template_s ** tmpl)
 {
-  ml_service_s *mls = (ml_service_s *) handle;
-  _ml_service_offloading_s *offloading_s;
-  int ret = ML_ERROR_NONE;
+  _mlrs_service_template_s *t;
+  JsonObject *object;
+  int ret;
 
-  if (!_ml_service_handle_is_valid (mls)) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  t = g_try_new0 (_mlrs_service_template_s, 1);
+  if (!t) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the service template. Out of memory?");
   }
 
-  offloading_s = (_ml_service_offloading_s *) mls->priv;
-
-  if (g_ascii_strcasecmp (name, "path") == 0) {
-    if (!g_file_test (value, G_FILE_TEST_IS_DIR)) {
-      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-          "The given param, dir path '%s' is invalid or the dir is not found or accessible.",
-          value);
-    }
-
-    if (g_access (value, W_OK) != 0) {
-      _ml_error_report_return (ML_ERROR_PERMISSION_DENIED,
-          "Write permission to dir '%s' is denied.", value);
-    }
-
-    g_free (offloading_s->path);
-    offloading_s->path = g_strdup (value);
+  t->node = json_from_string (value, NULL);
+  object = t->node ? json_node_get_object (t->node) : NULL;
+  if (!object) {
+    _mlrs_service_template_free (t);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to parse the json string, %s.", value);
+  }
 
-    if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
-      ret = _ml_service_training_offloading_set_path (mls, offloading_s->path);
-    }
+  ret = _mlrs_build_edge_data (object, &t->data_h);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _mlrs_service_template_free (t);
+    return ML_ERROR_INVALID_PARAMETER;
   }
 
-  return ret;
+  t->service_str = _ml_service_get_json_string_member (object, "service-type");
+  t->service_type = _mlrs_get_service_type ((gchar *) t->service_str);
+
+  *tmpl = t;
+  return ML_ERROR_NONE;
 }
 
 /**
@@ -783,6 +3060,8 @@ _ml_service_offloading_set_service (ml_service_s * mls, const gchar * key,
     const gchar * value)
 {
   _ml_service_offloading_s *offloading_s;
+  _mlrs_service_template_s *tmpl = NULL;
+  int ret;
 
   if (!STR_IS_VALID (key) || !STR_IS_VALID (value)) {
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
@@ -790,8 +3069,13 @@ _ml_service_offloading_set_service (ml_service_s * mls, const gchar * key,
   }
   offloading_s = (_ml_service_offloading_s *) mls->priv;
 
+  ret = _mlrs_service_template_new (value, &tmpl);
+  if (ML_ERROR_NONE != ret)
+    return ret;
+
   g_hash_table_insert (offloading_s->option_table, g_strdup (key),
       g_strdup (value));
+  g_hash_table_insert (offloading_s->template_table, g_strdup (key), tmpl);
 
   return ML_ERROR_NONE;
 }
@@ -866,6 +3150,7 @@ _ml_service_offloading_create_from_option (ml_service_s * mls,
         "Failed to allocate memory for the option table of ml-service offloading. Out of memory?");
   }
 
+  g_mutex_init (&offloading_s->service_lock);
   offloading_s->service_table =
       g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
       _cleanup_pipeline_service);
@@ -874,6 +3159,38 @@ _ml_service_offloading_create_from_option (ml_service_s * mls,
         "Failed to allocate memory for the service table of ml-service offloading. Out of memory?");
   }
 
+  g_mutex_init (&offloading_s->transfer_lock);
+  g_cond_init (&offloading_s->transfer_cond);
+  offloading_s->sent_files =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+  offloading_s->transfer_table =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      _mlrs_transfer_free);
+  offloading_s->template_table =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      _mlrs_service_template_free);
+  g_mutex_init (&offloading_s->coalesce_lock);
+  g_cond_init (&offloading_s->coalesce_cond);
+  g_mutex_init (&offloading_s->worker_lock);
+  offloading_s->worker_queues =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      _mlrs_worker_queue_free);
+  offloading_s->process_stats =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+  offloading_s->workers = DEFAULT_WORKERS;
+  offloading_s->coalesce = 1U;
+  offloading_s->coalesce_interval = DEFAULT_COALESCE_INTERVAL;
+  g_mutex_init (&offloading_s->stats_lock);
+  g_mutex_init (&offloading_s->probe_lock);
+  g_cond_init (&offloading_s->probe_cond);
+  offloading_s->probe_table =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  offloading_s->chunk_size = DEFAULT_CHUNK_SIZE;
+  offloading_s->max_raw_size = DEFAULT_MAX_RAW_SIZE;
+  offloading_s->download_parallel = DEFAULT_DOWNLOAD_PARALLEL;
+  offloading_s->cache_dir =
+      g_build_filename (g_get_user_cache_dir (), "ml-offloading", NULL);
+
   if (ML_ERROR_NONE == ml_option_get (option, "path", (void **) (&_path))) {
     ret = _ml_service_offloading_set_information (mls, "path", _path);
     if (ML_ERROR_NONE != ret) {
@@ -882,6 +3199,87 @@ _ml_service_offloading_create_from_option (ml_service_s * mls,
     }
   }
 
+  if (ML_ERROR_NONE == ml_option_get (option, "chunk-size",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "chunk-size", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set chunk size in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "cache-dir",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "cache-dir", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set cache dir in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "download-parallel",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "download-parallel",
+        _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set the number of parallel download in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "dedup-timeout",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "dedup-timeout", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set dedup timeout in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "compression",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "compression", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set compression in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "max-raw-size",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "max-raw-size", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set max raw size in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "coalesce", (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "coalesce", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set the number of coalesced requests in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "coalesce-interval",
+          (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "coalesce-interval",
+        _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set coalesce interval in ml-service offloading handle.");
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "workers", (void **) (&_path))) {
+    ret = _ml_service_offloading_set_information (mls, "workers", _path);
+    if (ML_ERROR_NONE != ret) {
+      _ml_error_report_return (ret,
+          "Failed to set the number of workers in ml-service offloading handle.");
+    }
+  }
+
   _mlrs_get_edge_info (option, &edge_info);
 
   offloading_s->node_type = edge_info->node_type;
@@ -992,64 +3390,390 @@ _ml_service_offloading_create (ml_service_h handle, JsonObject * object)
   }
 
 done:
-  if (option)
-    ml_option_destroy (option);
+  if (option)
+    ml_option_destroy (option);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to start ml-service offloading.
+ */
+int
+_ml_service_offloading_start (ml_service_h handle)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  _ml_service_offloading_s *offloading_s;
+  int ret = ML_ERROR_NONE;
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
+    ret = _ml_service_training_offloading_start (mls);
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report ("Failed to start training offloading.");
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to stop ml-service offloading.
+ */
+int
+_ml_service_offloading_stop (ml_service_h handle)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  _ml_service_offloading_s *offloading_s;
+  int ret = ML_ERROR_NONE;
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
+    ret = _ml_service_training_offloading_stop (mls);
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report ("Failed to stop training offloading.");
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to get the template of the service registered in ml-service offloading handle.
+ */
+static int
+_mlrs_get_service_template (_ml_service_offloading_s * offloading_s,
+    const gchar * key, _mlrs_service_template_s ** tmpl)
+{
+  *tmpl = g_hash_table_lookup (offloading_s->template_table, key);
+  if (!*tmpl) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The given service key, %s, is not registered in the ml-service offloading handle.",
+        key);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to create edge data with the information of the service.
+ */
+static int
+_mlrs_create_edge_data (_mlrs_service_template_s * tmpl,
+    nns_edge_data_h * data)
+{
+  int ret;
+
+  ret = nns_edge_data_copy (tmpl->data_h, data);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    _ml_error_report ("Failed to create an edge data.");
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to send the coalesced requests.
+ * @note The caller should hold the coalesce lock.
+ */
+static void
+_mlrs_coalesce_flush (_ml_service_offloading_s * offloading_s,
+    _mlrs_service_template_s * tmpl)
+{
+  gchar value[16];
+  int ret;
+
+  if (!tmpl->pending)
+    return;
+
+  g_snprintf (value, sizeof (value), "%u", tmpl->pending_count);
+  ret = nns_edge_data_set_info (tmpl->pending, "coalesced", value);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_send (offloading_s->edge_h, tmpl->pending);
+
+  if (NNS_EDGE_ERROR_NONE != ret)
+    _ml_error_report ("Failed to send %u coalesced requests.",
+        tmpl->pending_count);
+
+  nns_edge_data_destroy (tmpl->pending);
+  tmpl->pending = NULL;
+  tmpl->pending_count = 0;
+}
+
+/**
+ * @brief Thread to send the coalesced requests waiting longer than the interval.
+ */
+static gpointer
+_mlrs_coalesce_thread (gpointer data)
+{
+  _ml_service_offloading_s *offloading_s = (_ml_service_offloading_s *) data;
+  _mlrs_service_template_s *tmpl;
+  GHashTableIter iter;
+  gint64 interval, now, end_time;
+
+  interval = (gint64) offloading_s->coalesce_interval * G_TIME_SPAN_MILLISECOND;
+
+  g_mutex_lock (&offloading_s->coalesce_lock);
+  while (offloading_s->coalesce_running) {
+    now = g_get_monotonic_time ();
+    end_time = now + interval;
+
+    g_hash_table_iter_init (&iter, offloading_s->template_table);
+    while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & tmpl)) {
+      if (!tmpl->pending)
+        continue;
+
+      if (tmpl->pending_time + interval <= now)
+        _mlrs_coalesce_flush (offloading_s, tmpl);
+      else
+        end_time = MIN (end_time, tmpl->pending_time + interval);
+    }
+
+    g_cond_wait_until (&offloading_s->coalesce_cond,
+        &offloading_s->coalesce_lock, end_time);
+  }
+
+  /* Send the remained requests. */
+  g_hash_table_iter_init (&iter, offloading_s->template_table);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) & tmpl))
+    _mlrs_coalesce_flush (offloading_s, tmpl);
+  g_mutex_unlock (&offloading_s->coalesce_lock);
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to coalesce the request into an edge message.
+ * The payload is copied once and released with edge data, since the caller may release the input after the request.
+ */
+static int
+_mlrs_coalesce_request (_ml_service_offloading_s * offloading_s,
+    _mlrs_service_template_s * tmpl, const void *data, gsize len)
+{
+  gpointer payload;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  payload = g_try_malloc (len);
+  if (!payload) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the coalesced request. Out of memory?");
+  }
+  memcpy (payload, data, len);
+
+  g_mutex_lock (&offloading_s->coalesce_lock);
+  if (!offloading_s->coalesce_thread) {
+    offloading_s->coalesce_running = TRUE;
+    offloading_s->coalesce_thread = g_thread_try_new ("ml-offloading-coalesce",
+        _mlrs_coalesce_thread, offloading_s, NULL);
+    if (!offloading_s->coalesce_thread) {
+      offloading_s->coalesce_running = FALSE;
+      g_mutex_unlock (&offloading_s->coalesce_lock);
+      g_free (payload);
+      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+          "Failed to create the thread to send the coalesced requests.");
+    }
+  }
+
+  if (!tmpl->pending) {
+    ret = _mlrs_create_edge_data (tmpl, &tmpl->pending);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      goto done;
+
+    tmpl->pending_time = g_get_monotonic_time ();
+  }
+
+  ret = nns_edge_data_add (tmpl->pending, payload, len, g_free);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    _ml_error_report ("Failed to add the request to the coalesced message.");
+    goto done;
+  }
+
+  payload = NULL;
+  tmpl->pending_count++;
+
+  if (tmpl->pending_count >= offloading_s->coalesce)
+    _mlrs_coalesce_flush (offloading_s, tmpl);
+  else if (tmpl->pending_count == 1)
+    g_cond_signal (&offloading_s->coalesce_cond);
+
+done:
+  g_mutex_unlock (&offloading_s->coalesce_lock);
+  g_free (payload);
+  return ret;
+}
 
-  return status;
+/**
+ * @brief Internal function to check whether the model of the service should be sent in chunks.
+ */
+static gboolean
+_mlrs_use_chunk (_ml_service_offloading_s * offloading_s,
+    _mlrs_service_template_s * tmpl, guint64 total)
+{
+  if (offloading_s->chunk_size == 0 || total <= offloading_s->chunk_size)
+    return FALSE;
+
+  return (tmpl->service_type == ML_SERVICE_OFFLOADING_TYPE_MODEL_RAW);
 }
 
 /**
- * @brief Internal function to start ml-service offloading.
+ * @brief Internal function to send a chunk of the model file.
+ * The receiver writes the chunks to the temporary file in order, checks the checksum of each chunk, and registers the model with the last chunk.
  */
-int
-_ml_service_offloading_start (ml_service_h handle)
+static int
+_mlrs_send_chunk (_ml_service_offloading_s * offloading_s,
+    _mlrs_service_template_s * tmpl, const gchar * transfer_id,
+    const gchar * content_hash, guint64 offset, guint64 total, void *data,
+    gsize len)
 {
-  ml_service_s *mls = (ml_service_s *) handle;
-  _ml_service_offloading_s *offloading_s;
-  int ret = ML_ERROR_NONE;
+  nns_edge_data_h data_h = NULL;
+  g_autofree gchar *checksum = NULL;
+  gchar value[32];
+  guint retry;
+  int ret;
 
-  if (!_ml_service_handle_is_valid (mls)) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  ret = _mlrs_create_edge_data (tmpl, &data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  checksum = g_compute_checksum_for_data (G_CHECKSUM_SHA256, data, len);
+
+  ret = nns_edge_data_set_info (data_h, "transfer-id", transfer_id);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  g_snprintf (value, sizeof (value), "%" G_GUINT64_FORMAT, offset);
+  ret = nns_edge_data_set_info (data_h, "chunk-offset", value);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  g_snprintf (value, sizeof (value), "%" G_GUINT64_FORMAT, total);
+  ret = nns_edge_data_set_info (data_h, "total-size", value);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  ret = nns_edge_data_set_info (data_h, "chunk-checksum", checksum);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  /* The receiver checks the whole file before replacing the model. */
+  ret = nns_edge_data_set_info (data_h, "content-hash", content_hash);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  if (offloading_s->dedup_timeout > 0) {
+    ret = nns_edge_data_set_info (data_h, "content-dedup", "true");
+    if (NNS_EDGE_ERROR_NONE != ret)
+      goto done;
   }
 
-  offloading_s = (_ml_service_offloading_s *) mls->priv;
+  ret = _mlrs_add_payload (offloading_s, data_h, data, len);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
 
-  if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
-    ret = _ml_service_training_offloading_start (mls);
-    if (ret != ML_ERROR_NONE) {
-      _ml_error_report ("Failed to start training offloading.");
-    }
+  /* Retry the chunk if the connection is dropped, the receiver resumes from the written offset. */
+  for (retry = 0; retry <= MAX_SEND_RETRY; retry++) {
+    ret = nns_edge_send (offloading_s->edge_h, data_h);
+    if (NNS_EDGE_ERROR_NONE == ret)
+      break;
+
+    _ml_logw ("Failed to send the chunk (offset %" G_GUINT64_FORMAT
+        "), retry %u.", offset, retry + 1);
+    g_usleep (100000 * (retry + 1));
   }
 
+done:
+  if (NNS_EDGE_ERROR_NONE != ret)
+    _ml_error_report ("Failed to send the chunk of the model file.");
+
+  nns_edge_data_destroy (data_h);
   return ret;
 }
 
 /**
- * @brief Internal function to stop ml-service offloading.
+ * @brief Internal function to check whether the receiver already has the content, before sending the data.
+ * @return TRUE if the receiver has registered the content, so that the data is not required.
  */
-int
-_ml_service_offloading_stop (ml_service_h handle)
+static gboolean
+_mlrs_content_probe (_ml_service_offloading_s * offloading_s,
+    _mlrs_service_template_s * tmpl, const gchar * hash, guint64 total)
 {
-  ml_service_s *mls = (ml_service_s *) handle;
-  _ml_service_offloading_s *offloading_s;
-  int ret = ML_ERROR_NONE;
+  nns_edge_data_h data_h = NULL;
+  g_autofree gchar *probe_id = NULL;
+  gchar value[32];
+  gint64 end_time;
+  gint result = PROBE_MISS;
+  int ret;
 
-  if (!_ml_service_handle_is_valid (mls)) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  if (offloading_s->dedup_timeout == 0 || !hash)
+    return FALSE;
+
+  switch (tmpl->service_type) {
+    case ML_SERVICE_OFFLOADING_TYPE_MODEL_RAW:
+    case ML_SERVICE_OFFLOADING_TYPE_PIPELINE_RAW:
+      break;
+    default:
+      return FALSE;
   }
 
-  offloading_s = (_ml_service_offloading_s *) mls->priv;
+  ret = _mlrs_create_edge_data (tmpl, &data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return FALSE;
 
-  if (offloading_s->offloading_mode == ML_SERVICE_OFFLOADING_MODE_TRAINING) {
-    ret = _ml_service_training_offloading_stop (mls);
-    if (ret != ML_ERROR_NONE) {
-      _ml_error_report ("Failed to stop training offloading.");
+  g_mutex_lock (&offloading_s->probe_lock);
+  probe_id = g_strdup_printf ("%08x%08x-%u", g_random_int (), g_random_int (),
+      ++offloading_s->probe_seq);
+  g_hash_table_insert (offloading_s->probe_table, g_strdup (probe_id),
+      GINT_TO_POINTER (PROBE_PENDING));
+  g_mutex_unlock (&offloading_s->probe_lock);
+
+  g_snprintf (value, sizeof (value), "%" G_GUINT64_FORMAT, total);
+
+  ret = nns_edge_data_set_info (data_h, "service-type", CONTENT_PROBE);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "target-type", tmpl->service_str);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "content-hash", hash);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "probe-id", probe_id);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "total-size", value);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_add (data_h, probe_id, strlen (probe_id) + 1, NULL);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_send (offloading_s->edge_h, data_h);
+
+  nns_edge_data_destroy (data_h);
+
+  g_mutex_lock (&offloading_s->probe_lock);
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    /* The receiver not supporting the probe does not reply, send the data after timeout. */
+    end_time = g_get_monotonic_time () +
+        (gint64) offloading_s->dedup_timeout * G_TIME_SPAN_MILLISECOND;
+
+    while ((result = GPOINTER_TO_INT (g_hash_table_lookup
+                (offloading_s->probe_table, probe_id))) == PROBE_PENDING) {
+      if (!g_cond_wait_until (&offloading_s->probe_cond,
+              &offloading_s->probe_lock, end_time)) {
+        result = PROBE_MISS;
+        break;
+      }
     }
   }
+  g_hash_table_remove (offloading_s->probe_table, probe_id);
+  g_mutex_unlock (&offloading_s->probe_lock);
 
-  return ret;
+  return (result == PROBE_HIT);
 }
 
 /**
@@ -1062,16 +3786,11 @@ _ml_service_offloading_request (ml_service_h handle, const char *key,
 {
   ml_service_s *mls = (ml_service_s *) handle;
   _ml_service_offloading_s *offloading_s = NULL;
-  const gchar *service_key = NULL;
   nns_edge_data_h data_h = NULL;
   int ret = NNS_EDGE_ERROR_NONE;
-  const gchar *service_str = NULL;
-  const gchar *description = NULL;
-  const gchar *name = NULL;
-  const gchar *activate = NULL;
   ml_tensors_data_s *_in = NULL;
-  g_autoptr (JsonNode) service_node = NULL;
-  JsonObject *service_obj;
+  _mlrs_service_template_s *tmpl = NULL;
+  g_autofree gchar *hash = NULL;
   guint i;
 
   if (!_ml_service_handle_is_valid (mls)) {
@@ -1090,79 +3809,75 @@ _ml_service_offloading_request (ml_service_h handle, const char *key,
 
   offloading_s = (_ml_service_offloading_s *) mls->priv;
 
-  service_str = g_hash_table_lookup (offloading_s->option_table, key);
-  if (!service_str) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The given service key, %s, is not registered in the ml-service offloading handle.",
-        key);
-  }
+  ret = _mlrs_get_service_template (offloading_s, key, &tmpl);
+  if (ML_ERROR_NONE != ret)
+    return ret;
 
-  service_node = json_from_string (service_str, NULL);
-  if (!service_node) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "Failed to parse the json string, %s.", service_str);
-  }
-  service_obj = json_node_get_object (service_node);
-  if (!service_obj) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "Failed to get the json object from the json node.");
-  }
+  _in = (ml_tensors_data_s *) input;
 
-  service_str =
-      _ml_service_get_json_string_member (service_obj, "service-type");
-  if (!service_str) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "Failed to get service type from the json object.");
+  /* Coalesce the high-rate tensors into an edge message. */
+  if (offloading_s->coalesce > 1 && _in->num_tensors == 1 &&
+      tmpl->service_type == ML_SERVICE_OFFLOADING_TYPE_REPLY) {
+    return _mlrs_coalesce_request (offloading_s, tmpl, _in->tensors[0].data,
+        _in->tensors[0].size);
   }
 
-  service_key = _ml_service_get_json_string_member (service_obj, "service-key");
-  if (!service_key) {
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "Failed to get service key from the json object.");
-  }
+  if (_in->num_tensors == 1) {
+    if (offloading_s->dedup_timeout > 0 ||
+        _mlrs_use_chunk (offloading_s, tmpl, _in->tensors[0].size)) {
+      hash = g_compute_checksum_for_data (G_CHECKSUM_SHA256,
+          _in->tensors[0].data, _in->tensors[0].size);
+    }
 
-  ret = nns_edge_data_create (&data_h);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    _ml_error_report ("Failed to create an edge data.");
-    return ret;
+    if (_mlrs_content_probe (offloading_s, tmpl, hash,
+            _in->tensors[0].size)) {
+      _ml_logi ("The receiver already has the content of service key '%s'.",
+          key);
+      return ML_ERROR_NONE;
+    }
   }
 
-  ret = nns_edge_data_set_info (data_h, "service-type", service_str);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    _ml_error_report ("Failed to set service type in edge data.");
-    goto done;
-  }
-  ret = nns_edge_data_set_info (data_h, "service-key", service_key);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    _ml_error_report ("Failed to set service key in edge data.");
-    goto done;
-  }
+  if (_in->num_tensors == 1 &&
+      _mlrs_use_chunk (offloading_s, tmpl, _in->tensors[0].size)) {
+    guint8 *raw = (guint8 *) _in->tensors[0].data;
+    gsize total = _in->tensors[0].size;
+    gsize offset, len;
 
-  description = _ml_service_get_json_string_member (service_obj, "description");
-  if (description) {
-    ret = nns_edge_data_set_info (data_h, "description", description);
-    if (NNS_EDGE_ERROR_NONE != ret) {
-      _ml_logi ("Failed to set description in edge data.");
+    /* The same model gets the same id (content hash), so that the receiver can resume the transfer. */
+    for (offset = 0; offset < total; offset += len) {
+      len = MIN (offloading_s->chunk_size, total - offset);
+
+      ret = _mlrs_send_chunk (offloading_s, tmpl, hash, hash, offset,
+          total, raw + offset, len);
+      if (NNS_EDGE_ERROR_NONE != ret)
+        break;
     }
+
+    return ret;
   }
 
-  name = _ml_service_get_json_string_member (service_obj, "name");
-  if (name) {
-    ret = nns_edge_data_set_info (data_h, "name", name);
-    if (NNS_EDGE_ERROR_NONE != ret) {
-      _ml_logi ("Failed to set name in edge data.");
-    }
+  ret = _mlrs_create_edge_data (tmpl, &data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    return ret;
+
+  /* The receiver keeps the content as the blob, to reply to the content probe. */
+  if (offloading_s->dedup_timeout > 0) {
+    ret = nns_edge_data_set_info (data_h, "content-dedup", "true");
+    if (NNS_EDGE_ERROR_NONE != ret)
+      goto done;
   }
 
-  activate = _ml_service_get_json_string_member (service_obj, "activate");
-  if (activate) {
-    ret = nns_edge_data_set_info (data_h, "activate", activate);
+  /* Compress the single payload such as model and pipeline. */
+  if (_in->num_tensors == 1) {
+    ret = _mlrs_add_payload (offloading_s, data_h, _in->tensors[0].data,
+        _in->tensors[0].size);
     if (NNS_EDGE_ERROR_NONE != ret) {
-      _ml_logi ("Failed to set activate in edge data.");
+      _ml_error_report ("Failed to add the payload to the edge data.");
+      goto done;
     }
   }
-  _in = (ml_tensors_data_s *) input;
-  for (i = 0; i < _in->num_tensors; i++) {
+
+  for (i = 0; _in->num_tensors > 1 && i < _in->num_tensors; i++) {
     ret =
         nns_edge_data_add (data_h, _in->tensors[i].data, _in->tensors[i].size,
         NULL);
@@ -1201,3 +3916,256 @@ _ml_service_offloading_request_raw (ml_service_h handle, const char *key,
 
   return _ml_service_offloading_request (handle, key, &input);
 }
+
+/**
+ * @brief Internal function to request service to ml-service offloading with the file.
+ * The model file is read and sent in chunks, to bound the memory usage.
+ */
+int
+_ml_service_offloading_request_file (ml_service_h handle, const char *key,
+    const char *path)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  _ml_service_offloading_s *offloading_s = NULL;
+  _mlrs_service_template_s *tmpl = NULL;
+  g_autofree gchar *transfer_id = NULL;
+  g_autofree gchar *seed = NULL;
+  g_autofree gchar *hash = NULL;
+  g_autofree guint8 *chunk = NULL;
+  GStatBuf st;
+  FILE *fp = NULL;
+  guint64 offset;
+  gsize len;
+  int ret = ML_ERROR_NONE;
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  if (!STR_IS_VALID (key) || !STR_IS_VALID (path)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'key' or 'path' is NULL. It should be a valid string.");
+  }
+
+  if (g_stat (path, &st) != 0) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to get the status of file '%s'.", path);
+  }
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  ret = _mlrs_get_service_template (offloading_s, key, &tmpl);
+  if (ML_ERROR_NONE != ret)
+    return ret;
+
+  if (offloading_s->dedup_timeout > 0) {
+    hash = _mlrs_compute_file_hash (path);
+
+    if (_mlrs_content_probe (offloading_s, tmpl, hash,
+            (guint64) st.st_size)) {
+      _ml_logi ("The receiver already has the content of file '%s'.", path);
+      goto done;
+    }
+  }
+
+  if (!_mlrs_use_chunk (offloading_s, tmpl, (guint64) st.st_size)) {
+    g_autofree gchar *contents = NULL;
+
+    if (!g_file_get_contents (path, &contents, &len, NULL)) {
+      _ml_error_report_return (ML_ERROR_IO_ERROR,
+          "Failed to read file '%s'.", path);
+    }
+
+    ret = _ml_service_offloading_request_raw (mls, key, contents, len);
+    goto done;
+  }
+
+  if (!hash) {
+    hash = _mlrs_compute_file_hash (path);
+    if (!hash) {
+      _ml_error_report_return (ML_ERROR_IO_ERROR,
+          "Failed to compute the content hash of file '%s'.", path);
+    }
+  }
+
+  fp = g_fopen (path, "rb");
+  chunk = g_try_malloc (offloading_s->chunk_size);
+  if (!fp || !chunk) {
+    if (fp)
+      fclose (fp);
+    _ml_error_report_return (ML_ERROR_IO_ERROR,
+        "Failed to prepare to read file '%s'.", path);
+  }
+
+  /* The same file gets the same id, so that the receiver can resume the transfer. */
+  seed = g_strdup_printf ("%s:%s:%" G_GUINT64_FORMAT ":%" G_GINT64_FORMAT,
+      key, path, (guint64) st.st_size, (gint64) st.st_mtime);
+  transfer_id = g_compute_checksum_for_string (G_CHECKSUM_SHA256, seed, -1);
+
+  for (offset = 0; offset < (guint64) st.st_size; offset += len) {
+    len = fread (chunk, 1, offloading_s->chunk_size, fp);
+    if (len == 0) {
+      _ml_error_report ("Failed to read file '%s'.", path);
+      ret = ML_ERROR_IO_ERROR;
+      break;
+    }
+
+    ret = _mlrs_send_chunk (offloading_s, tmpl, transfer_id, hash, offset,
+        (guint64) st.st_size, chunk, len);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      break;
+  }
+
+  fclose (fp);
+
+done:
+  /* The receiver may send the delta against this file. Keep the hash not to read the file again. */
+  if (ML_ERROR_NONE == ret) {
+    if (!hash)
+      hash = _mlrs_compute_file_hash (path);
+
+    if (hash) {
+      g_mutex_lock (&offloading_s->transfer_lock);
+      g_hash_table_replace (offloading_s->sent_files, g_strdup (path),
+          g_steal_pointer (&hash));
+      g_mutex_unlock (&offloading_s->transfer_lock);
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to request service to ml-service offloading with the delta of the file.
+ * The changed blocks against the base file are sent, and the receiver rebuilds the file with the base file it has.
+ */
+int
+_ml_service_offloading_request_file_delta (ml_service_h handle,
+    const char *key, const char *path, const char *base_path)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  _ml_service_offloading_s *offloading_s = NULL;
+  _mlrs_service_template_s *tmpl = NULL;
+  nns_edge_data_h data_h = NULL;
+  g_autofree gchar *base_hash = NULL;
+  g_autofree gchar *content_hash = NULL;
+  g_autofree guint8 *block = NULL;
+  g_autofree guint8 *base_block = NULL;
+  GByteArray *delta = NULL;
+  GStatBuf st;
+  FILE *fp = NULL, *base_fp = NULL;
+  guint64 nblocks, i;
+  gsize len, base_len;
+  gchar value[32];
+  int ret = ML_ERROR_NONE;
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  if (!STR_IS_VALID (key) || !STR_IS_VALID (path) || !STR_IS_VALID (base_path)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'key', 'path' or 'base_path' is NULL. It should be a valid string.");
+  }
+
+  if (g_stat (path, &st) != 0 || st.st_size == 0 || st.st_size > G_MAXUINT) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to get the status of file '%s'.", path);
+  }
+
+  offloading_s = (_ml_service_offloading_s *) mls->priv;
+
+  ret = _mlrs_get_service_template (offloading_s, key, &tmpl);
+  if (ML_ERROR_NONE != ret)
+    return ret;
+
+  base_hash = _mlrs_compute_file_hash (base_path);
+  content_hash = _mlrs_compute_file_hash (path);
+  fp = g_fopen (path, "rb");
+  base_fp = g_fopen (base_path, "rb");
+  if (!base_hash || !content_hash || !fp || !base_fp)
+    goto fallback;
+
+  nblocks = ((guint64) st.st_size + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+  delta = g_byte_array_sized_new ((guint) ((nblocks + 7) / 8));
+  g_byte_array_set_size (delta, (guint) ((nblocks + 7) / 8));
+  memset (delta->data, 0, delta->len);
+
+  block = g_malloc (DELTA_BLOCK_SIZE);
+  base_block = g_malloc (DELTA_BLOCK_SIZE);
+
+  for (i = 0; i < nblocks; i++) {
+    len = fread (block, 1, DELTA_BLOCK_SIZE, fp);
+    base_len = fread (base_block, 1, DELTA_BLOCK_SIZE, base_fp);
+    if (len == 0)
+      goto fallback;
+
+    if (len != base_len || memcmp (block, base_block, len) != 0) {
+      delta->data[i / 8] |= (guint8) (1U << (i % 8));
+      g_byte_array_append (delta, block, (guint) len);
+    }
+
+    /* Send the whole file if most of the blocks are changed. */
+    if (delta->len > (guint64) st.st_size / 2)
+      goto fallback;
+  }
+
+  ret = _mlrs_create_edge_data (tmpl, &data_h);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+
+  ret = nns_edge_data_set_info (data_h, "delta-base", base_hash);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_data_set_info (data_h, "content-hash", content_hash);
+  if (NNS_EDGE_ERROR_NONE == ret && offloading_s->dedup_timeout > 0)
+    ret = nns_edge_data_set_info (data_h, "content-dedup", "true");
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    g_snprintf (value, sizeof (value), "%u", DELTA_BLOCK_SIZE);
+    ret = nns_edge_data_set_info (data_h, "delta-block-size", value);
+  }
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    g_snprintf (value, sizeof (value), "%" G_GUINT64_FORMAT,
+        (guint64) st.st_size);
+    ret = nns_edge_data_set_info (data_h, "total-size", value);
+  }
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = _mlrs_add_payload (offloading_s, data_h, delta->data, delta->len);
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_send (offloading_s->edge_h, data_h);
+
+  if (NNS_EDGE_ERROR_NONE != ret)
+    _ml_error_report ("Failed to send the delta of file '%s'.", path);
+  else
+    _ml_logd ("Sent the delta (%u bytes) of file '%s' (%" G_GUINT64_FORMAT
+        " bytes).", delta->len, path, (guint64) st.st_size);
+
+  goto done;
+
+fallback:
+  _ml_logi ("Failed to make the delta of file '%s', send the whole file.",
+      path);
+  if (fp)
+    fclose (fp);
+  if (base_fp)
+    fclose (base_fp);
+  fp = base_fp = NULL;
+  if (delta)
+    g_byte_array_free (delta, TRUE);
+  delta = NULL;
+
+  ret = _ml_service_offloading_request_file (handle, key, path);
+
+done:
+  if (data_h)
+    nns_edge_data_destroy (data_h);
+  if (delta)
+    g_byte_array_free (delta, TRUE);
+  if (fp)
+    fclose (fp);
+  if (base_fp)
+    fclose (base_fp);
+
+  return ret;
+}
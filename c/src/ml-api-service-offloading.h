@@ -112,8 +112,42 @@ int _ml_service_offloading_request (ml_service_h handle, const char *key, const
  */
 int _ml_service_offloading_request_raw (ml_service_h handle, const char *key, void *data, size_t len);
 
+/**
+ * @brief Internal function to request service to ml-service offloading with the file.
+ * @details If the service type is 'model_raw' and the file is larger than the chunk size ('chunk-size', default 1 MiB), the file is read and sent in chunks.
+ * @param[in] handle The handle of ml-service.
+ * @param[in] key The key of machine learning service.
+ * @param[in] path The path of the file to be registered on the offloading server.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_IO_ERROR Failed to read the file.
+ */
+int _ml_service_offloading_request_file (ml_service_h handle, const char *key, const char *path);
+
+/**
+ * @brief Internal function to request service to ml-service offloading with the delta of the file.
+ * @details The file is compared with @a base_path in fixed-size blocks, and only the changed blocks are sent. The remote rebuilds the file with the base file it has (the file received or sent before), and verifies the hash of the file before registering it.
+ *          The remote keeps the received file as the base only when the sender sets the option 'dedup-timeout'.
+ *          If the delta is not smaller than the half of the file, the whole file is sent with _ml_service_offloading_request_file().
+ * @param[in] handle The handle of ml-service.
+ * @param[in] key The key of machine learning service.
+ * @param[in] path The path of the file to be registered on the offloading server.
+ * @param[in] base_path The path of the base file the remote already has.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_IO_ERROR Failed to read the file.
+ */
+int _ml_service_offloading_request_file_delta (ml_service_h handle, const char *key, const char *path, const char *base_path);
+
 /**
  * @brief Internal function to set a required value in ml-service offloading handle.
+ * @details With the name "workers", the received data is processed in the given number of worker threads (0 by default, to process it in the edge callback).
+ *          The data of the same service key is processed in order, but the data of different keys is processed concurrently.
+ *          Then the event callback of ml-service is invoked in the worker threads, concurrently for different keys, so the callback should be thread-safe.
  * @param[in] handle The handle of ml-service.
  * @param[in] name The service key.
  * @param[in] value The value to set.
@@ -124,6 +158,18 @@ int _ml_service_offloading_request_raw (ml_service_h handle, const char *key, vo
  */
 int _ml_service_offloading_set_information (ml_service_h handle, const char *name, const char *value);
 
+/**
+ * @brief Internal function to get the runtime information of ml-service offloading.
+ * @param[in] mls ml-service handle.
+ * @param[in] name The name of the information, see below keys.
+ *            (compression_count, compression_ratio, compression_time, decompression_count, decompression_time, queue_depth, processed_<type>, processing_time_avg_<type>, processing_time_max_<type>. The type is the service type such as model_raw, and the time is in microseconds.)
+ * @param[out] value The value of the information. The caller should release it using g_free().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the information is not found.
+ */
+int _ml_service_offloading_get_information (ml_service_s *mls, const char *name, char **value);
+
 /**
  * @brief Internal function to set offloading mode and private data.
  * @param[in] handle The handle of ml-service.
@@ -158,7 +204,10 @@ int _ml_service_offloading_release_internal (ml_service_s *mls);
 #define _ml_service_offloading_stop(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_request(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_request_raw(...) ML_ERROR_NOT_SUPPORTED
+#define _ml_service_offloading_request_file(...) ML_ERROR_NOT_SUPPORTED
+#define _ml_service_offloading_request_file_delta(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_set_information(...) ML_ERROR_NOT_SUPPORTED
+#define _ml_service_offloading_get_information(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_release_internal(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_set_mode(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_offloading_get_mode(...) ML_ERROR_NOT_SUPPORTED
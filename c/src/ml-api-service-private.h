@@ -18,6 +18,7 @@
 #include <json-glib/json-glib.h>
 
 #include <ml-api-service.h>
+#include <ml-api-staging.h>
 #include <ml-api-inference-internal.h>
 #include <mlops-agent-interface.h>
 
@@ -156,6 +157,16 @@ int _ml_service_invoke_event_new_data (ml_service_s * mls, const char *name, con
  */
 void _ml_service_pipeline_sink_cb (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data);
 
+/**
+ * @brief Internal function to remove the activated model of given name in the cache of ml-service agent information.
+ */
+void _ml_service_model_cache_invalidate (const char *name);
+
+/**
+ * @brief Internal function to fetch the activated models of given names into the cache of ml-service agent information at once.
+ */
+int _ml_service_model_cache_prefetch (const char **names, unsigned int count);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
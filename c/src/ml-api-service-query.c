@@ -17,40 +17,288 @@
 #include <string.h>
 
 #include "ml-api-internal.h"
+#include "ml-api-inference-pipeline-internal.h"
 #include "ml-api-service-query.h"
 
 /**
- * @brief Structure for ml_service_query
+ * @brief The max number of query servers in ml_service_query.
+ */
+#define ML_SERVICE_QUERY_MAX_ENDPOINTS (64U)
+
+/**
+ * @brief The number of consecutive timeouts to regard the query server as unhealthy.
+ */
+#define ML_SERVICE_QUERY_UNHEALTHY_TIMEOUTS (3U)
+
+/**
+ * @brief The initial and max interval to send a request to the unhealthy query server again, in microseconds.
+ */
+#define ML_SERVICE_QUERY_REPROBE_INTERVAL (G_TIME_SPAN_SECOND)
+#define ML_SERVICE_QUERY_REPROBE_INTERVAL_MAX (32 * G_TIME_SPAN_SECOND)
+
+/**
+ * @brief The weight of new sample for the moving average of latency.
+ */
+#define ML_SERVICE_QUERY_LATENCY_WEIGHT (0.2)
+
+typedef struct _ml_service_query_s _ml_service_query_s;
+
+/**
+ * @brief Structure for the query server (endpoint) in ml_service_query
  */
 typedef struct
 {
+  _ml_service_query_s *query;
+  guint index;
+  gchar *name; /**< The address of query server, host:port */
+
   ml_pipeline_h pipe_h;
   ml_pipeline_src_h src_h;
   ml_pipeline_sink_h sink_h;
+  GstElement *client; /**< tensor_query_client, to get the sequence number of the request in process */
+
+  gboolean processing; /**< The request of sequence number 'processing_seq' is in process and not responded yet */
+  guint64 processing_seq;
+
+  GQueue pending; /**< The requests sent to this server, in order of sequence number */
+  guint outstanding; /**< The number of requests sent to this server and not responded yet, except the abandoned requests */
+  guint consecutive_timeouts;
+  gint64 reprobe_time; /**< The monotonic time to send a request to the unhealthy server again */
+  gint64 reprobe_interval; /**< The back-off interval to check the unhealthy server */
+  gdouble latency_avg; /**< The moving average of latency in microseconds */
+  guint64 requests;
+  guint64 responses;
+  guint64 timeouts;
+} _ml_service_query_endpoint_s;
+
+/**
+ * @brief Structure for the request in ml_service_query
+ */
+typedef struct
+{
+  guint64 seq; /**< The sequence number of the request */
+  gboolean done;
+  gboolean sent; /**< tensor_query_client received the input and sent it to the query server */
+  gboolean abandoned; /**< The caller does not wait for the output (e.g., timed out). */
+  gint64 start_time; /**< The monotonic time when the input is sent */
+  gint64 end_time; /**< The monotonic time to wait for the output until */
+  ml_tensors_data_h output;
+  ml_service_query_cb cb; /**< The callback of asynchronous request */
+  void *user_data;
+  ml_tensors_data_h input; /**< The copied input of asynchronous request to fail over */
+  _ml_service_query_endpoint_s *endpoint; /**< The query server processing the request */
+  guint64 tried; /**< The bitmask of the query servers tried */
+} _ml_service_query_request_s;
+
+/**
+ * @brief Structure for ml_service_query
+ */
+struct _ml_service_query_s
+{
+  GPtrArray *endpoints; /**< The query servers */
 
   guint timeout; /**< in ms unit */
-  GAsyncQueue *out_data_queue;
-} _ml_service_query_s;
+
+  GMutex lock;
+  GCond cond;
+  guint64 seq; /**< The sequence number of next request */
+  guint outstanding; /**< The number of requests waiting for the output */
+  guint max_outstanding; /**< The max number of outstanding requests, 0 means unlimited */
+
+  GThread *cb_thread; /**< The thread to invoke the callback of asynchronous request */
+  gboolean cb_running;
+  GQueue completed; /**< The asynchronous requests to be delivered to the callback */
+};
+
+/**
+ * @brief Internal function to release the request in ml_service_query
+ */
+static void
+_ml_service_query_request_free (gpointer data)
+{
+  _ml_service_query_request_s *req = (_ml_service_query_request_s *) data;
+
+  if (!req)
+    return;
+
+  if (req->output)
+    ml_tensors_data_destroy (req->output);
+
+  if (req->input)
+    ml_tensors_data_destroy (req->input);
+
+  g_free (req);
+}
+
+/**
+ * @brief Internal function to release the query server in ml_service_query
+ */
+static void
+_ml_service_query_endpoint_free (gpointer data)
+{
+  _ml_service_query_endpoint_s *ep = (_ml_service_query_endpoint_s *) data;
+  _ml_service_query_request_s *req;
+
+  if (!ep)
+    return;
+
+  if (ep->pipe_h) {
+    if (ml_pipeline_destroy (ep->pipe_h))
+      _ml_error_report ("Failed to destroy pipeline");
+  }
+
+  if (ep->client)
+    gst_object_unref (ep->client);
+
+  /* The requests still in the queue are abandoned by the callers. */
+  while ((req = g_queue_pop_head (&ep->pending)))
+    _ml_service_query_request_free (req);
+
+  g_free (ep->name);
+  g_free (ep);
+}
+
+/**
+ * @brief Internal function to compare the sequence number of the request.
+ */
+static gint
+_ml_service_query_request_compare_seq (gconstpointer a, gconstpointer b)
+{
+  const _ml_service_query_request_s *req = (const _ml_service_query_request_s *) a;
+  const guint64 *seq = (const guint64 *) b;
+
+  return (req->seq == *seq) ? 0 : 1;
+}
+
+/**
+ * @brief Pad probe to get the sequence number of the request, when tensor_query_client receives the input buffer.
+ * tensor_query_client sends the requests one by one, so the request waits in the pipeline until the previous one is responded or timed out.
+ * The requests sent before this one and still in the queue will never be responded (e.g., timed out in tensor_query_client). Release the abandoned requests.
+ * If the caller already gave up this request while it was waiting, drop the buffer not to send the expired request to the query server.
+ */
+static GstPadProbeReturn
+_ml_service_query_client_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  _ml_service_query_endpoint_s *ep = (_ml_service_query_endpoint_s *) user_data;
+  _ml_service_query_s *query = ep->query;
+  _ml_service_query_request_s *req;
+  GstPadProbeReturn ret = GST_PAD_PROBE_OK;
+  GstBuffer *buffer;
+  GList *l, *next;
+
+  buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  if (!buffer)
+    return GST_PAD_PROBE_OK;
+
+  g_mutex_lock (&query->lock);
+
+  ep->processing = (GST_BUFFER_OFFSET (buffer) != GST_BUFFER_OFFSET_NONE);
+  ep->processing_seq = GST_BUFFER_OFFSET (buffer);
+
+  for (l = ep->pending.head; l && ep->processing; l = next) {
+    next = l->next;
+    req = (_ml_service_query_request_s *) l->data;
+
+    if (req->seq > ep->processing_seq)
+      break;
+
+    if (req->seq == ep->processing_seq && !req->abandoned) {
+      req->sent = TRUE;
+      continue;
+    }
+
+    if (req->abandoned) {
+      if (req->seq == ep->processing_seq) {
+        /* Expired before sending, tensor_query_client will not push the output. */
+        ep->processing = FALSE;
+        ret = GST_PAD_PROBE_DROP;
+      }
+
+      g_queue_delete_link (&ep->pending, l);
+      _ml_service_query_request_free (req);
+    }
+  }
+
+  g_mutex_unlock (&query->lock);
+  return ret;
+}
 
 /**
  * @brief Sink callback for query_client
+ * tensor_query_client processes the buffers one by one and pushes the output in the streaming thread of the input buffer.
+ * The output is matched with the request of sequence number in process, which is given as the offset of the input buffer.
  */
 static void
 _sink_callback_for_query_client (const ml_tensors_data_h data,
     const ml_tensors_info_h info, void *user_data)
 {
-  _ml_service_query_s *query = (_ml_service_query_s *) user_data;
-  ml_tensors_data_h copied;
+  _ml_service_query_endpoint_s *ep = (_ml_service_query_endpoint_s *) user_data;
+  _ml_service_query_s *query = ep->query;
+  _ml_service_query_request_s *req;
+  ml_tensors_data_h copied = NULL;
+  GList *l;
+  gdouble latency;
   int status;
 
+  g_mutex_lock (&query->lock);
+
+  if (!ep->processing) {
+    _ml_logw ("Received the output from query server without request, drop it.");
+    goto done;
+  }
+
+  /* Only one output for the request. */
+  ep->processing = FALSE;
+
+  l = g_queue_find_custom (&ep->pending, &ep->processing_seq,
+      _ml_service_query_request_compare_seq);
+  if (!l) {
+    _ml_logw ("Received the output of unknown request (seq %" G_GUINT64_FORMAT
+        "), drop it.", ep->processing_seq);
+    goto done;
+  }
+
+  req = (_ml_service_query_request_s *) l->data;
+  g_queue_delete_link (&ep->pending, l);
+
+  ep->responses++;
+  ep->consecutive_timeouts = 0;
+  ep->reprobe_interval = 0;
+
+  latency = (gdouble) (g_get_monotonic_time () - req->start_time);
+  if (ep->latency_avg > 0)
+    ep->latency_avg += ML_SERVICE_QUERY_LATENCY_WEIGHT * (latency - ep->latency_avg);
+  else
+    ep->latency_avg = latency;
+
+  if (req->abandoned) {
+    /* The caller does not wait for the output. */
+    _ml_logw ("Received the output of timed-out request (seq %" G_GUINT64_FORMAT
+        "), drop it.", req->seq);
+    _ml_service_query_request_free (req);
+    goto done;
+  }
+
+  ep->outstanding--;
+
   status = ml_tensors_data_clone (data, &copied);
   if (ML_ERROR_NONE != status) {
     _ml_error_report_continue
         ("Failed to create a new tensors data for query_client.");
-    return;
   }
 
-  g_async_queue_push (query->out_data_queue, copied);
+  req->output = copied;
+  req->done = TRUE;
+
+  /* The callback thread delivers the output of asynchronous request. */
+  if (req->cb)
+    g_queue_push_tail (&query->completed, req);
+
+  g_cond_broadcast (&query->cond);
+
+done:
+  g_mutex_unlock (&query->lock);
 }
 
 /**
@@ -60,31 +308,150 @@ int
 _ml_service_query_release_internal (ml_service_s * mls)
 {
   _ml_service_query_s *query = (_ml_service_query_s *) mls->priv;
-  ml_tensors_data_h data_h;
+  _ml_service_query_endpoint_s *ep;
+  guint i;
 
   /* Supposed internal function call to release handle. */
   if (!query)
     return ML_ERROR_NONE;
 
-  if (query->pipe_h) {
-    if (ml_pipeline_destroy (query->pipe_h))
-      _ml_error_report ("Failed to destroy pipeline");
-  }
+  /* Stop the pipelines first, no more output after this. */
+  if (query->endpoints) {
+    for (i = 0; i < query->endpoints->len; i++) {
+      ep = g_ptr_array_index (query->endpoints, i);
 
-  if (query->out_data_queue) {
-    while ((data_h = g_async_queue_try_pop (query->out_data_queue))) {
-      ml_tensors_data_destroy (data_h);
+      if (ep->pipe_h) {
+        if (ml_pipeline_destroy (ep->pipe_h))
+          _ml_error_report ("Failed to destroy pipeline");
+        ep->pipe_h = NULL;
+      }
     }
+  }
+
+  if (query->cb_thread) {
+    g_mutex_lock (&query->lock);
+    query->cb_running = FALSE;
+    g_cond_broadcast (&query->cond);
+    g_mutex_unlock (&query->lock);
+
+    g_thread_join (query->cb_thread);
+    query->cb_thread = NULL;
+  }
 
-    g_async_queue_unref (query->out_data_queue);
+  if (query->endpoints) {
+    g_ptr_array_free (query->endpoints, TRUE);
+    query->endpoints = NULL;
   }
 
+  g_mutex_clear (&query->lock);
+  g_cond_clear (&query->cond);
   g_free (query);
   mls->priv = NULL;
 
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to create the pipeline of tensor_query_client for the query server.
+ */
+static int
+_ml_service_query_endpoint_create (_ml_service_query_s * query,
+    const gchar * name, const gchar * caps, const gchar * prop)
+{
+  int status = ML_ERROR_NONE;
+  g_autofree gchar *description = NULL;
+  _ml_service_query_endpoint_s *ep;
+  ml_pipeline_element_h client_h = NULL;
+  GstPad *pad;
+
+  ep = g_try_new0 (_ml_service_query_endpoint_s, 1);
+  if (ep == NULL) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the query server. Out of memory?");
+  }
+
+  ep->query = query;
+  ep->index = query->endpoints->len;
+  ep->name = g_strdup (name);
+  g_queue_init (&ep->pending);
+  g_ptr_array_add (query->endpoints, ep);
+
+  description =
+      g_strdup_printf
+      ("appsrc name=srcx ! %s ! tensor_query_client %s name=qcx ! tensor_sink name=sinkx async=false sync=false",
+      caps, prop);
+
+  status = ml_pipeline_construct (description, NULL, NULL, &ep->pipe_h);
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status, "Failed to construct pipeline");
+  }
+
+  /* Get the sequence number of the request before tensor_query_client sends it. */
+  status = ml_pipeline_element_get_handle (ep->pipe_h, "qcx", &client_h);
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status, "Failed to get tensor_query_client");
+  }
+
+  ep->client = _ml_pipeline_get_gst_element (client_h);
+  ml_pipeline_element_release_handle (client_h);
+
+  pad = ep->client ? gst_element_get_static_pad (ep->client, "sink") : NULL;
+  if (!pad) {
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to get the sink pad of tensor_query_client.");
+  }
+
+  gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER,
+      _ml_service_query_client_probe, ep, NULL);
+  gst_object_unref (pad);
+
+  status = ml_pipeline_start (ep->pipe_h);
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status, "Failed to start pipeline");
+  }
+
+  status = ml_pipeline_src_get_handle (ep->pipe_h, "srcx", &ep->src_h);
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status, "Failed to get src handle");
+  }
+
+  status = ml_pipeline_sink_register (ep->pipe_h, "sinkx",
+      _sink_callback_for_query_client, ep, &ep->sink_h);
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status, "Failed to register sink handle");
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to parse the query server address, host:port.
+ */
+static int
+_ml_service_query_parse_endpoint (const gchar * address, gchar ** host,
+    guint * port)
+{
+  const gchar *pos;
+  guint64 val;
+  gchar *endptr = NULL;
+
+  pos = strrchr (address, ':');
+  if (!pos || pos == address) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The query server '%s' is invalid. It should be host:port.", address);
+  }
+
+  val = g_ascii_strtoull (pos + 1, &endptr, 10);
+  if (endptr == pos + 1 || *endptr != '\0' || val == 0 || val > 65535) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The port of query server '%s' is invalid.", address);
+  }
+
+  *host = g_strndup (address, pos - address);
+  *port = (guint) val;
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Internal function to create query client service handle with given ml-option handle.
  */
@@ -93,17 +460,18 @@ _ml_service_query_create (ml_service_s * mls, ml_option_h option)
 {
   int status = ML_ERROR_NONE;
 
-  g_autofree gchar *description = NULL;
   void *value;
 
   GString *tensor_query_client_prop;
   g_autofree gchar *prop = NULL;
+  g_auto (GStrv) addresses = NULL;
+  guint i, num;
+  guint client_port = 0U;
 
   _ml_service_query_s *query_s;
-  ml_pipeline_h pipe_h;
-  ml_pipeline_src_h src_h;
-  ml_pipeline_sink_h sink_h;
   g_autofree gchar *caps = NULL;
+  g_autofree gchar *dest_host = NULL;
+  guint dest_port = 0U;
   guint timeout = 1000U;        /* default 1s timeout */
 
   g_return_val_if_fail (mls && option, ML_ERROR_INVALID_PARAMETER);
@@ -114,6 +482,27 @@ _ml_service_query_create (ml_service_s * mls, ml_option_h option)
         "Failed to allocate memory for the service handle's private data. Out of memory?");
   }
 
+  g_mutex_init (&query_s->lock);
+  g_cond_init (&query_s->cond);
+  g_queue_init (&query_s->completed);
+  query_s->endpoints =
+      g_ptr_array_new_with_free_func (_ml_service_query_endpoint_free);
+
+  /* The list of query servers, e.g., "192.168.0.10:3000,192.168.0.11:3000". */
+  if (ML_ERROR_NONE == ml_option_get (option, "endpoints", &value)) {
+    addresses = g_strsplit ((gchar *) value, ",", -1);
+
+    num = g_strv_length (addresses);
+    if (num == 0 || num > ML_SERVICE_QUERY_MAX_ENDPOINTS) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'endpoints' is invalid. It should include 1 to %u query servers.",
+          ML_SERVICE_QUERY_MAX_ENDPOINTS);
+    }
+
+    for (i = 0; i < num; i++)
+      g_strstrip (addresses[i]);
+  }
+
   tensor_query_client_prop = g_string_new (NULL);
 
   if (ML_ERROR_NONE == ml_option_get (option, "host", &value))
@@ -121,16 +510,13 @@ _ml_service_query_create (ml_service_s * mls, ml_option_h option)
         (gchar *) value);
 
   if (ML_ERROR_NONE == ml_option_get (option, "port", &value))
-    g_string_append_printf (tensor_query_client_prop, " port=%u ",
-        *((guint *) value));
+    client_port = *((guint *) value);
 
   if (ML_ERROR_NONE == ml_option_get (option, "dest-host", &value))
-    g_string_append_printf (tensor_query_client_prop, " dest-host=%s ",
-        (gchar *) value);
+    dest_host = g_strdup ((gchar *) value);
 
   if (ML_ERROR_NONE == ml_option_get (option, "dest-port", &value))
-    g_string_append_printf (tensor_query_client_prop, " dest-port=%u ",
-        *((guint *) value));
+    dest_port = *((guint *) value);
 
   if (ML_ERROR_NONE == ml_option_get (option, "connect-type", &value))
     g_string_append_printf (tensor_query_client_prop, " connect-type=%s ",
@@ -140,9 +526,13 @@ _ml_service_query_create (ml_service_s * mls, ml_option_h option)
     g_string_append_printf (tensor_query_client_prop, " topic=%s ",
         (gchar *) value);
 
-  if (ML_ERROR_NONE == ml_option_get (option, "timeout", &value))
-    g_string_append_printf (tensor_query_client_prop, " timeout=%u ",
-        *((guint *) value));
+  if (ML_ERROR_NONE == ml_option_get (option, "timeout", &value)) {
+    timeout = *((guint *) value);
+    g_string_append_printf (tensor_query_client_prop, " timeout=%u ", timeout);
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "max-outstanding", &value))
+    query_s->max_outstanding = *((guint *) value);
 
   if (ML_ERROR_NONE != ml_option_get (option, "caps", &value)) {
     g_string_free (tensor_query_client_prop, TRUE);
@@ -152,44 +542,297 @@ _ml_service_query_create (ml_service_s * mls, ml_option_h option)
   caps = g_strdup ((gchar *) value);
 
   prop = g_string_free (tensor_query_client_prop, FALSE);
-  description =
-      g_strdup_printf
-      ("appsrc name=srcx ! %s ! tensor_query_client %s name=qcx ! tensor_sink name=sinkx async=false sync=false",
-      caps, prop);
+  query_s->timeout = timeout;
 
-  status = ml_pipeline_construct (description, NULL, NULL, &pipe_h);
-  if (ML_ERROR_NONE != status) {
-    _ml_error_report_return (status, "Failed to construct pipeline");
+  if (addresses) {
+    for (i = 0; addresses[i]; i++) {
+      g_autofree gchar *host = NULL;
+      g_autofree gchar *ep_prop = NULL;
+      guint port;
+
+      status = _ml_service_query_parse_endpoint (addresses[i], &host, &port);
+      if (ML_ERROR_NONE != status)
+        return status;
+
+      /* Each pipeline needs its own client port. */
+      if (client_port > 0)
+        ep_prop = g_strdup_printf ("%s port=%u dest-host=%s dest-port=%u ",
+            prop, client_port + i, host, port);
+      else
+        ep_prop = g_strdup_printf ("%s dest-host=%s dest-port=%u ",
+            prop, host, port);
+
+      status = _ml_service_query_endpoint_create (query_s, addresses[i],
+          caps, ep_prop);
+      if (ML_ERROR_NONE != status)
+        return status;
+    }
+  } else {
+    g_autofree gchar *name = NULL;
+    GString *ep_prop = g_string_new (prop);
+
+    if (client_port > 0)
+      g_string_append_printf (ep_prop, " port=%u ", client_port);
+    if (dest_host)
+      g_string_append_printf (ep_prop, " dest-host=%s ", dest_host);
+    if (dest_port > 0)
+      g_string_append_printf (ep_prop, " dest-port=%u ", dest_port);
+
+    name = g_strdup_printf ("%s:%u", dest_host ? dest_host : "localhost",
+        dest_port);
+    status = _ml_service_query_endpoint_create (query_s, name, caps,
+        ep_prop->str);
+    g_string_free (ep_prop, TRUE);
+
+    if (ML_ERROR_NONE != status)
+      return status;
   }
 
-  status = ml_pipeline_start (pipe_h);
-  if (ML_ERROR_NONE != status) {
-    ml_pipeline_destroy (pipe_h);
-    _ml_error_report_return (status, "Failed to start pipeline");
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to select the query server for the request. The caller should hold the lock.
+ * The unhealthy server is selected when the back-off interval is passed, to check whether it is recovered.
+ * Otherwise, healthy server first, then the server with fewer outstanding requests, then lower latency.
+ */
+static _ml_service_query_endpoint_s *
+_ml_service_query_select_endpoint (_ml_service_query_s * query, guint64 tried)
+{
+  _ml_service_query_endpoint_s *ep, *selected = NULL;
+  gboolean healthy, selected_healthy = FALSE;
+  gint64 now;
+  guint i;
+
+  now = g_get_monotonic_time ();
+
+  for (i = 0; i < query->endpoints->len; i++) {
+    ep = g_ptr_array_index (query->endpoints, i);
+
+    if (tried & (G_GUINT64_CONSTANT (1) << ep->index))
+      continue;
+
+    healthy = (ep->consecutive_timeouts < ML_SERVICE_QUERY_UNHEALTHY_TIMEOUTS);
+
+    if (!healthy && ep->reprobe_time <= now) {
+      /* Check the unhealthy server again, and double the interval until it responds. */
+      ep->reprobe_time = now + ep->reprobe_interval;
+      ep->reprobe_interval = MIN (ep->reprobe_interval * 2,
+          ML_SERVICE_QUERY_REPROBE_INTERVAL_MAX);
+      return ep;
+    }
+
+    if (selected) {
+      if (healthy != selected_healthy) {
+        if (!healthy)
+          continue;
+      } else if (ep->outstanding != selected->outstanding) {
+        if (ep->outstanding > selected->outstanding)
+          continue;
+      } else if (ep->latency_avg >= selected->latency_avg) {
+        continue;
+      }
+    }
+
+    selected = ep;
+    selected_healthy = healthy;
   }
 
-  status = ml_pipeline_src_get_handle (pipe_h, "srcx", &src_h);
-  if (ML_ERROR_NONE != status) {
-    ml_pipeline_destroy (pipe_h);
-    _ml_error_report_return (status, "Failed to get src handle");
+  return selected;
+}
+
+/**
+ * @brief Internal function to send the input data to the query server and push the request into the queue. The caller should hold the lock.
+ */
+static int
+_ml_service_query_dispatch (_ml_service_query_s * query,
+    const ml_tensors_data_h input, _ml_service_query_request_s * req)
+{
+  _ml_service_query_endpoint_s *ep;
+  int status;
+
+  ep = _ml_service_query_select_endpoint (query, req->tried);
+  if (!ep) {
+    _ml_error_report_return (ML_ERROR_TIMED_OUT,
+        "There is no query server to process the request.");
   }
 
-  status = ml_pipeline_sink_register (pipe_h, "sinkx",
-      _sink_callback_for_query_client, query_s, &sink_h);
+  /* The sequence number is given as the offset of the input buffer, to match the output with the request. */
+  req->seq = query->seq++;
+
+  status = _ml_pipeline_src_input_data_with_offset (ep->src_h, input,
+      ML_PIPELINE_BUF_POLICY_DO_NOT_FREE, req->seq);
   if (ML_ERROR_NONE != status) {
-    ml_pipeline_destroy (pipe_h);
-    _ml_error_report_return (status, "Failed to register sink handle");
+    _ml_error_report_return (status, "Failed to input data");
   }
 
-  query_s->timeout = timeout;
-  query_s->pipe_h = pipe_h;
-  query_s->src_h = src_h;
-  query_s->sink_h = sink_h;
-  query_s->out_data_queue = g_async_queue_new ();
+  req->endpoint = ep;
+  req->tried |= (G_GUINT64_CONSTANT (1) << ep->index);
+  req->start_time = g_get_monotonic_time ();
+  req->end_time = req->start_time + query->timeout * G_TIME_SPAN_MILLISECOND;
+
+  g_queue_push_tail (&ep->pending, req);
+  ep->outstanding++;
+  ep->requests++;
 
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to push new request with the input data. The caller should hold the lock.
+ */
+static int
+_ml_service_query_push_request (_ml_service_query_s * query,
+    const ml_tensors_data_h input, _ml_service_query_request_s * req)
+{
+  int status;
+
+  if (query->max_outstanding > 0 &&
+      query->outstanding >= query->max_outstanding) {
+    _ml_error_report_return (ML_ERROR_TRY_AGAIN,
+        "Too many outstanding requests (%u), try again later.",
+        query->outstanding);
+  }
+
+  status = _ml_service_query_dispatch (query, input, req);
+  if (ML_ERROR_NONE == status)
+    query->outstanding++;
+
+  return status;
+}
+
+/**
+ * @brief Internal function to send the timed-out request to other query server. The caller should hold the lock.
+ * The timed-out request remains in the queue of the server until the server processes next request, and its output will be dropped.
+ * The request timed out while waiting for the previous requests is not sent, and it is not counted as the timeout of the server.
+ * Returns new request, or NULL if there is no query server to try.
+ */
+static _ml_service_query_request_s *
+_ml_service_query_failover (_ml_service_query_s * query,
+    const ml_tensors_data_h input, _ml_service_query_request_s * req)
+{
+  _ml_service_query_request_s *retry;
+
+  /* The abandoned request is not counted, so that the server is selected again and checked whether it is alive. */
+  req->abandoned = TRUE;
+  req->endpoint->outstanding--;
+
+  if (req->sent) {
+    req->endpoint->timeouts++;
+    req->endpoint->consecutive_timeouts++;
+  }
+
+  if (req->endpoint->reprobe_interval == 0 &&
+      req->endpoint->consecutive_timeouts >= ML_SERVICE_QUERY_UNHEALTHY_TIMEOUTS) {
+    req->endpoint->reprobe_interval = ML_SERVICE_QUERY_REPROBE_INTERVAL;
+    req->endpoint->reprobe_time =
+        g_get_monotonic_time () + req->endpoint->reprobe_interval;
+  }
+
+  if (!input || query->endpoints->len <= 1)
+    return NULL;
+
+  retry = g_try_new0 (_ml_service_query_request_s, 1);
+  if (!retry)
+    return NULL;
+
+  retry->cb = req->cb;
+  retry->user_data = req->user_data;
+  retry->tried = req->tried;
+
+  if (ML_ERROR_NONE != _ml_service_query_dispatch (query, input, retry)) {
+    g_free (retry);
+    return NULL;
+  }
+
+  /* The copied input of asynchronous request moves to new request. */
+  retry->input = req->input;
+  req->input = NULL;
+
+  _ml_logi ("The request (seq %" G_GUINT64_FORMAT ") is timed out in %s, "
+      "fail over to %s.", req->seq, req->endpoint->name,
+      retry->endpoint->name);
+  return retry;
+}
+
+/**
+ * @brief Thread to invoke the callback of asynchronous request, with the output or timeout error.
+ */
+static gpointer
+_ml_service_query_cb_thread (gpointer data)
+{
+  _ml_service_query_s *query = (_ml_service_query_s *) data;
+  _ml_service_query_endpoint_s *ep;
+  _ml_service_query_request_s *req, *expired;
+  ml_service_query_cb cb;
+  void *user_data;
+  GList *l;
+  gint64 now, wake_time;
+  guint i;
+
+  g_mutex_lock (&query->lock);
+  while (query->cb_running || !g_queue_is_empty (&query->completed)) {
+    req = g_queue_pop_head (&query->completed);
+    if (req) {
+      query->outstanding--;
+      g_mutex_unlock (&query->lock);
+
+      req->cb (req->output ? ML_ERROR_NONE : ML_ERROR_OUT_OF_MEMORY,
+          req->output, req->user_data);
+      _ml_service_query_request_free (req);
+
+      g_mutex_lock (&query->lock);
+      continue;
+    }
+
+    /* Find the timed-out request, and get the time to wake up. */
+    now = g_get_monotonic_time ();
+    wake_time = now + G_TIME_SPAN_SECOND;
+    expired = NULL;
+
+    for (i = 0; i < query->endpoints->len && !expired; i++) {
+      ep = g_ptr_array_index (query->endpoints, i);
+
+      for (l = ep->pending.head; l; l = l->next) {
+        req = (_ml_service_query_request_s *) l->data;
+
+        if (!req->cb || req->abandoned)
+          continue;
+
+        if (req->end_time <= now) {
+          expired = req;
+          break;
+        }
+
+        wake_time = MIN (wake_time, req->end_time);
+      }
+    }
+
+    if (expired) {
+      if (_ml_service_query_failover (query, expired->input, expired))
+        continue;
+
+      query->outstanding--;
+
+      cb = expired->cb;
+      user_data = expired->user_data;
+      g_mutex_unlock (&query->lock);
+
+      _ml_logw ("Failed to get the output of the asynchronous request, timeout.");
+      cb (ML_ERROR_TIMED_OUT, NULL, user_data);
+
+      g_mutex_lock (&query->lock);
+      continue;
+    }
+
+    if (query->cb_running)
+      g_cond_wait_until (&query->cond, &query->lock, wake_time);
+  }
+  g_mutex_unlock (&query->lock);
+
+  return NULL;
+}
+
 /**
  * @brief Internal function to request an output to query client service with given input data.
  */
@@ -199,22 +842,178 @@ _ml_service_query_request (ml_service_s * mls,
 {
   int status = ML_ERROR_NONE;
   _ml_service_query_s *query;
+  _ml_service_query_request_s *req, *retry;
+  guint64 seq;
 
   g_return_val_if_fail (mls && input && output, ML_ERROR_INVALID_PARAMETER);
 
   query = (_ml_service_query_s *) mls->priv;
 
-  status = ml_pipeline_src_input_data (query->src_h, input,
-      ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  req = g_try_new0 (_ml_service_query_request_s, 1);
+  if (!req) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the request. Out of memory?");
+  }
+
+  g_mutex_lock (&query->lock);
+  status = _ml_service_query_push_request (query, input, req);
   if (ML_ERROR_NONE != status) {
-    _ml_error_report_return (status, "Failed to input data");
+    g_mutex_unlock (&query->lock);
+    g_free (req);
+    return status;
   }
 
-  *output = g_async_queue_timeout_pop (query->out_data_queue,
-      query->timeout * G_TIME_SPAN_MILLISECOND);
-  if (NULL == *output) {
-    _ml_error_report_return (ML_ERROR_TIMED_OUT, "timeout!");
+  while (!req->done) {
+    if (g_cond_wait_until (&query->cond, &query->lock, req->end_time) ||
+        req->done)
+      continue;
+
+    /* Timed out, try other query server. */
+    retry = _ml_service_query_failover (query, input, req);
+    if (!retry)
+      break;
+
+    req = retry;
   }
 
+  seq = req->seq;
+  query->outstanding--;
+  if (req->done) {
+    *output = req->output;
+    req->output = NULL;
+    _ml_service_query_request_free (req);
+
+    if (NULL == *output)
+      status = ML_ERROR_OUT_OF_MEMORY;
+  } else {
+    status = ML_ERROR_TIMED_OUT;
+  }
+  g_mutex_unlock (&query->lock);
+
+  if (ML_ERROR_NONE != status) {
+    _ml_error_report_return (status,
+        "Failed to get the output of the request (seq %" G_GUINT64_FORMAT ").",
+        seq);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to request an output to query client service asynchronously.
+ */
+int
+_ml_service_query_request_async (ml_service_s * mls,
+    const ml_tensors_data_h input, ml_service_query_cb cb, void *user_data)
+{
+  int status = ML_ERROR_NONE;
+  _ml_service_query_s *query;
+  _ml_service_query_request_s *req;
+
+  g_return_val_if_fail (mls && input && cb, ML_ERROR_INVALID_PARAMETER);
+
+  query = (_ml_service_query_s *) mls->priv;
+
+  req = g_try_new0 (_ml_service_query_request_s, 1);
+  if (!req) {
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the request. Out of memory?");
+  }
+
+  req->cb = cb;
+  req->user_data = user_data;
+
+  /* Keep the input to send it to other query server when the request is timed out. */
+  if (query->endpoints->len > 1) {
+    status = ml_tensors_data_clone (input, &req->input);
+    if (ML_ERROR_NONE != status) {
+      g_free (req);
+      _ml_error_report_return (status,
+          "Failed to copy the input data of the request.");
+    }
+  }
+
+  g_mutex_lock (&query->lock);
+  if (!query->cb_thread) {
+    query->cb_running = TRUE;
+    query->cb_thread = g_thread_try_new ("ml-query-cb",
+        _ml_service_query_cb_thread, query, NULL);
+
+    if (!query->cb_thread) {
+      query->cb_running = FALSE;
+      g_mutex_unlock (&query->lock);
+      _ml_service_query_request_free (req);
+      _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+          "Failed to create a thread for the asynchronous request.");
+    }
+  }
+
+  status = _ml_service_query_push_request (query, input, req);
+  if (ML_ERROR_NONE != status) {
+    _ml_service_query_request_free (req);
+  } else {
+    /* Wake up the callback thread to update the time to check timeout. */
+    g_cond_broadcast (&query->cond);
+  }
+  g_mutex_unlock (&query->lock);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to get the statistics of query servers.
+ */
+int
+_ml_service_query_get_information (ml_service_s * mls, const char *name,
+    gchar ** value)
+{
+  _ml_service_query_s *query = (_ml_service_query_s *) mls->priv;
+  _ml_service_query_endpoint_s *ep;
+  g_autofree gchar *prefix = NULL;
+  const gchar *pos;
+  gchar *endptr = NULL;
+  gchar *val = NULL;
+  guint64 index;
+
+  if (!query)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  if (g_ascii_strcasecmp (name, "endpoint_count") == 0) {
+    *value = g_strdup_printf ("%u", query->endpoints->len);
+    return ML_ERROR_NONE;
+  }
+
+  /* The statistics of each query server, e.g., latency_avg_0. */
+  pos = strrchr (name, '_');
+  if (!pos)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  index = g_ascii_strtoull (pos + 1, &endptr, 10);
+  if (endptr == pos + 1 || *endptr != '\0' || index >= query->endpoints->len)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  prefix = g_strndup (name, pos - name);
+  ep = g_ptr_array_index (query->endpoints, (guint) index);
+
+  g_mutex_lock (&query->lock);
+  if (g_ascii_strcasecmp (prefix, "endpoint") == 0) {
+    val = g_strdup (ep->name);
+  } else if (g_ascii_strcasecmp (prefix, "outstanding") == 0) {
+    val = g_strdup_printf ("%u", ep->outstanding);
+  } else if (g_ascii_strcasecmp (prefix, "requests") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, ep->requests);
+  } else if (g_ascii_strcasecmp (prefix, "responses") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, ep->responses);
+  } else if (g_ascii_strcasecmp (prefix, "timeouts") == 0) {
+    val = g_strdup_printf ("%" G_GUINT64_FORMAT, ep->timeouts);
+  } else if (g_ascii_strcasecmp (prefix, "latency_avg") == 0) {
+    val = g_strdup_printf ("%" G_GINT64_FORMAT, (gint64) ep->latency_avg);
+  }
+  g_mutex_unlock (&query->lock);
+
+  if (!val)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  *value = val;
   return ML_ERROR_NONE;
 }
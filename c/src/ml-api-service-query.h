@@ -33,10 +33,22 @@ int _ml_service_query_create (ml_service_s *mls, ml_option_h option);
  * @brief Internal function to request an output to query client service with given input data.
  */
 int _ml_service_query_request (ml_service_s *mls, const ml_tensors_data_h input, ml_tensors_data_h *output);
+
+/**
+ * @brief Internal function to request an output to query client service asynchronously.
+ */
+int _ml_service_query_request_async (ml_service_s *mls, const ml_tensors_data_h input, ml_service_query_cb cb, void *user_data);
+
+/**
+ * @brief Internal function to get the statistics of query servers.
+ */
+int _ml_service_query_get_information (ml_service_s *mls, const char *name, gchar **value);
 #else
 #define _ml_service_query_release_internal(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_query_create(...) ML_ERROR_NOT_SUPPORTED
 #define _ml_service_query_request(...) ML_ERROR_NOT_SUPPORTED
+#define _ml_service_query_request_async(...) ML_ERROR_NOT_SUPPORTED
+#define _ml_service_query_get_information(...) ML_ERROR_NOT_SUPPORTED
 #endif /*ENABLE_NNSTREAMER_EDGE */
 
 #ifdef __cplusplus
@@ -11,6 +11,7 @@
  */
 
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <json-glib/json-glib.h>
 #include <nnstreamer-edge.h>
 
@@ -27,6 +28,12 @@
 /** default receive time limit (second) */
 #define DEFAULT_TIME_LIMIT 10
 
+/** default number of files sent concurrently */
+#define DEFAULT_TRANSFER_PARALLEL 4
+
+/** default max size (bytes) of the files being sent at once */
+#define DEFAULT_MAX_INFLIGHT_SIZE (64 * 1024 * 1024)
+
 /**
  * @brief Internal enumeration for ml-service training offloading types.
  */
@@ -51,18 +58,43 @@ typedef struct
   gchar *receiver_pipe;
   gchar *sender_pipe;
   gchar *trained_model_path;    /* reply to remote sender */
+  gchar *delta_base;            /* The model the remote sender has, to reply the trained model as the delta */
   gchar *path;                  /* Readable and writable path set by the app */
 
   gboolean is_received;
   gint time_limit;              /* second, For receiving the data necessary for training */
   GMutex received_lock;
   GCond received_cond;
-  GThread *received_thread;
+
+  gint transfer_parallel;       /* The number of files sent concurrently */
+  gint64 max_inflight_size;     /* The max size (bytes) of the files being sent at once */
 
   GHashTable *transfer_data_table;
   GHashTable *node_table;
 } ml_training_services_s;
 
+/**
+ * @brief Internal structure to send the transfer files concurrently.
+ */
+typedef struct
+{
+  ml_service_s *mls;
+  GMutex lock;
+  GCond cond;
+  gint64 inflight_size;
+  int status;
+} ml_training_transfer_s;
+
+/**
+ * @brief Internal structure for the transfer file to be sent.
+ */
+typedef struct
+{
+  gchar *name;
+  gchar *path;
+  gint64 size;
+} ml_training_transfer_file_s;
+
 /**
  * @brief Internal function to check offloading mode and get private data for training.
  */
@@ -138,6 +170,23 @@ _training_offloading_node_info_new (ml_service_s * mls,
   return node_info;
 }
 
+/**
+ * @brief Internal function to get the integer member of json object. Returns FALSE if the member is not an integer.
+ */
+static gboolean
+_training_offloading_get_int_member (JsonObject * object, const gchar * name,
+    gint64 * value)
+{
+  JsonNode *node = json_object_get_member (object, name);
+
+  if (!node || !JSON_NODE_HOLDS_VALUE (node) ||
+      json_node_get_value_type (node) != G_TYPE_INT64)
+    return FALSE;
+
+  *value = json_node_get_int (node);
+  return TRUE;
+}
+
 /**
  * @brief Internal function to parse configuration file.
  */
@@ -150,6 +199,7 @@ _training_offloading_conf_parse_json (ml_service_s * mls, JsonObject * object)
   const gchar *key, *val;
   gchar *transfer_data = NULL;
   GList *list, *iter;
+  gint64 int_val;
   int ret;
 
   g_return_val_if_fail (object != NULL, ML_ERROR_INVALID_PARAMETER);
@@ -179,6 +229,31 @@ _training_offloading_conf_parse_json (ml_service_s * mls, JsonObject * object)
         ("The default time-limit(10 sec) is set because `time-limit` is not set.");
   }
 
+  if (json_object_has_member (training_obj, "transfer-parallel")) {
+    if (!_training_offloading_get_int_member (training_obj,
+            "transfer-parallel", &int_val) || int_val <= 0
+        || int_val > G_MAXINT) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, \"transfer-parallel\" is invalid. It should be a positive integer.");
+    }
+
+    training_s->transfer_parallel = (gint) int_val;
+  }
+
+  if (json_object_has_member (training_obj, "max-inflight-size")) {
+    if (!_training_offloading_get_int_member (training_obj,
+            "max-inflight-size", &int_val) || int_val <= 0) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The given param, \"max-inflight-size\" is invalid. It should be a positive integer.");
+    }
+
+    training_s->max_inflight_size = int_val;
+  }
+
+  val = _ml_service_get_json_string_member (training_obj, "delta-base");
+  if (STR_IS_VALID (val))
+    training_s->delta_base = g_strdup (val);
+
   val = _ml_service_get_json_string_member (training_obj, "sender-pipeline");
   training_s->sender_pipe = g_strdup (val);
 
@@ -363,6 +438,8 @@ _training_offloading_create (ml_service_s * mls)
 
   training_s->type = ML_TRAINING_OFFLOADING_TYPE_UNKNOWN;
   training_s->time_limit = DEFAULT_TIME_LIMIT;
+  training_s->transfer_parallel = DEFAULT_TRANSFER_PARALLEL;
+  training_s->max_inflight_size = DEFAULT_MAX_INFLIGHT_SIZE;
 
   _ml_service_offloading_set_mode (mls,
       ML_SERVICE_OFFLOADING_MODE_TRAINING, training_s);
@@ -437,18 +514,52 @@ _request_offloading_service (ml_service_s * mls,
   return ret;
 }
 
+/**
+ * @brief Thread pool function to send the transfer file.
+ */
+static void
+_training_offloading_transfer_func (gpointer data, gpointer user_data)
+{
+  ml_training_transfer_file_s *file = (ml_training_transfer_file_s *) data;
+  ml_training_transfer_s *transfer = (ml_training_transfer_s *) user_data;
+  int ret;
+
+  _ml_logd ("transfer_data:%s", file->path);
+
+  /* The model file is sent in chunks, not to load the whole file. */
+  ret = _ml_service_offloading_request_file (transfer->mls, file->name,
+      file->path);
+  if (ret != ML_ERROR_NONE)
+    _ml_error_report ("Failed to request service '%s'.", file->name);
+
+  g_mutex_lock (&transfer->lock);
+  transfer->inflight_size -= file->size;
+  if (transfer->status == ML_ERROR_NONE)
+    transfer->status = ret;
+  g_cond_broadcast (&transfer->cond);
+  g_mutex_unlock (&transfer->lock);
+
+  g_free (file->name);
+  g_free (file->path);
+  g_free (file);
+}
+
 /**
  * @brief Request all services to ml-service offloading.
+ * The transfer files are sent concurrently within the max size being sent at once, and the pipeline is sent last.
  */
 static int
 _training_offloading_services_request (ml_service_s * mls)
 {
   ml_training_services_s *training_s = NULL;
+  ml_training_transfer_s transfer = { 0 };
+  ml_training_transfer_file_s *file;
+  GThreadPool *pool;
   int ret = ML_ERROR_NONE;
   GList *list, *iter;
   gchar *transfer_data = NULL, *service_name = NULL;
-  gchar *contents = NULL, *pipeline = NULL;
-  gsize len = 0;
+  gchar *pipeline = NULL;
+  GStatBuf st;
 
   ret = _training_offloading_get_priv (mls, &training_s);
   g_return_val_if_fail (ret == ML_ERROR_NONE, ret);
@@ -461,6 +572,18 @@ _training_offloading_services_request (ml_service_s * mls)
         "Failed to get transfer data table");
   }
 
+  transfer.mls = mls;
+  g_mutex_init (&transfer.lock);
+  g_cond_init (&transfer.cond);
+
+  pool = g_thread_pool_new (_training_offloading_transfer_func, &transfer,
+      training_s->transfer_parallel, FALSE, NULL);
+  if (!pool) {
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    _ml_error_report ("Failed to create the thread pool to send the files.");
+    goto error;
+  }
+
   for (iter = list; iter != NULL; iter = g_list_next (iter)) {
     const gchar *name = iter->data;
 
@@ -471,31 +594,47 @@ _training_offloading_services_request (ml_service_s * mls)
       transfer_data = _ml_replace_string (transfer_data, APP_RW_PATH,
           training_s->path, NULL, NULL);
 
-      _ml_logd ("transfer_data:%s", transfer_data);
+      file = g_new0 (ml_training_transfer_file_s, 1);
+      file->name = g_strdup (name);
+      file->path = transfer_data;
+      file->size = (g_stat (transfer_data, &st) == 0) ? (gint64) st.st_size : 0;
+      transfer_data = NULL;
 
-      if (!g_file_get_contents (transfer_data, &contents, &len, NULL)) {
-        _ml_error_report ("Failed to read file:%s", transfer_data);
-        goto error;
-      }
+      /* Wait for the files being sent, not to exceed the max size in flight. */
+      g_mutex_lock (&transfer.lock);
+      while (transfer.status == ML_ERROR_NONE && transfer.inflight_size > 0 &&
+          transfer.inflight_size + file->size > training_s->max_inflight_size)
+        g_cond_wait (&transfer.cond, &transfer.lock);
+
+      ret = transfer.status;
+      if (ret == ML_ERROR_NONE)
+        transfer.inflight_size += file->size;
+      g_mutex_unlock (&transfer.lock);
 
-      ret = _request_offloading_service (mls, name, contents, len);
       if (ret != ML_ERROR_NONE) {
-        _ml_error_report ("Failed to request service '%s'.", name);
-        goto error;
+        g_free (file->name);
+        g_free (file->path);
+        g_free (file);
+        break;
       }
 
-      g_free (transfer_data);
-      g_free (contents);
-      transfer_data = NULL;
-      contents = NULL;
+      g_thread_pool_push (pool, file, NULL);
     } else if (g_strstr_len (transfer_data, -1, "pipeline")) {
       service_name = g_strdup (iter->data);
       pipeline = g_strdup (transfer_data);
+      g_free (transfer_data);
+      transfer_data = NULL;
+    } else {
+      g_free (transfer_data);
       transfer_data = NULL;
     }
   }
 
-  if (pipeline) {
+  /* Wait for all files to be sent. */
+  g_thread_pool_free (pool, FALSE, TRUE);
+  ret = transfer.status;
+
+  if (ret == ML_ERROR_NONE && pipeline) {
     /**
      * The remote sender sends the last in the pipeline.
      * When the pipeline arrives, the remote receiver determines that the sender has sent all the necessary files specified in the pipeline.
@@ -512,53 +651,16 @@ _training_offloading_services_request (ml_service_s * mls)
   }
 
 error:
+  g_mutex_clear (&transfer.lock);
+  g_cond_clear (&transfer.cond);
   g_free (service_name);
   g_free (transfer_data);
-  g_free (contents);
+  g_free (pipeline);
   g_list_free (list);
 
   return ret;
 }
 
-/**
- * @brief Thread for checking receive data.
- */
-static gpointer
-_check_received_data_thread (gpointer data)
-{
-  ml_training_services_s *training_s = (ml_training_services_s *) data;
-  gint usec;
-
-  g_return_val_if_fail (training_s != NULL, NULL);
-
-  usec = training_s->time_limit * 1000000;
-  while (usec > 0) {
-    g_usleep (100000);
-    if (training_s->receiver_pipe_json_str != NULL) {
-      _ml_logd
-          ("Lock to receive pipeline JSON string required for model training.");
-      g_mutex_lock (&training_s->received_lock);
-      training_s->is_received = TRUE;
-      _ml_logd ("receive_pipe:%s", training_s->receiver_pipe_json_str);
-      _ml_logd
-          ("Now pipeline has arrived, The remote sender send the pipeline last, so probably received all the data."
-          "If there are no files required for the pipeline, a runtime error occurs.");
-      g_cond_signal (&training_s->received_cond);
-      g_mutex_unlock (&training_s->received_lock);
-      return NULL;
-    }
-    usec -= 100000;
-  }
-
-  _ml_loge ("Required data is null, receive_pipe:%s",
-      training_s->receiver_pipe_json_str);
-  g_mutex_lock (&training_s->received_lock);
-  training_s->is_received = FALSE;
-  g_cond_signal (&training_s->received_cond);
-  g_mutex_unlock (&training_s->received_lock);
-  return NULL;
-}
-
 /**
  * @brief Check if all necessary data is received.
  */
@@ -566,24 +668,35 @@ static gboolean
 _training_offloading_check_received_data (ml_training_services_s * training_s)
 {
   gboolean is_received = FALSE;
+  gint64 end_time;
 
   g_return_val_if_fail (training_s != NULL, FALSE);
 
-  training_s->received_thread = g_thread_new ("check_received_file",
-      _check_received_data_thread, training_s);
+  end_time = g_get_monotonic_time () +
+      (gint64) training_s->time_limit * G_TIME_SPAN_SECOND;
 
   g_mutex_lock (&training_s->received_lock);
 
+  /* The pipeline is signaled when it arrives, see _ml_service_training_offloading_process_received_data(). */
   while (!training_s->is_received) {
     _ml_logd ("Wait to receive all data needed for model training.");
-    g_cond_wait (&training_s->received_cond, &training_s->received_lock);
-    if (training_s->is_received == FALSE)
+    if (!g_cond_wait_until (&training_s->received_cond,
+            &training_s->received_lock, end_time))
       break;
   }
 
   is_received = training_s->is_received;
   g_mutex_unlock (&training_s->received_lock);
-  _ml_logd ("unlock, receive all data");
+
+  if (is_received) {
+    _ml_logd ("receive_pipe:%s", training_s->receiver_pipe_json_str);
+    _ml_logd
+        ("Now pipeline has arrived, The remote sender send the pipeline last, so probably received all the data."
+        "If there are no files required for the pipeline, a runtime error occurs.");
+  } else {
+    _ml_loge ("Required data is null, receive_pipe:%s",
+        training_s->receiver_pipe_json_str);
+  }
 
   return is_received;
 }
@@ -809,9 +922,16 @@ _ml_service_training_offloading_process_received_data (ml_service_s * mls,
 
   if (training_s->type == ML_TRAINING_OFFLOADING_TYPE_RECEIVER) {
     if (service_type == ML_SERVICE_OFFLOADING_TYPE_PIPELINE_RAW) {
+      g_mutex_lock (&training_s->received_lock);
+      g_free (training_s->receiver_pipe_json_str);
       training_s->receiver_pipe_json_str = g_strdup (data);
       _ml_logd ("Received JSON string pipeline:%s",
           training_s->receiver_pipe_json_str);
+
+      /* The remote sender sends the pipeline last, wake up the receiver waiting for the data. */
+      training_s->is_received = TRUE;
+      g_cond_broadcast (&training_s->received_cond);
+      g_mutex_unlock (&training_s->received_lock);
     }
   } else {
     /* receive trained model from remote */
@@ -838,9 +958,8 @@ static void
 _training_offloading_send_trained_model (ml_service_s * mls)
 {
   ml_training_services_s *training_s = NULL;
+  g_autofree gchar *delta_base = NULL;
   GList *list, *iter;
-  gchar *contents = NULL;
-  gsize len = 0;
   int ret;
 
   ret = _training_offloading_get_priv (mls, &training_s);
@@ -849,10 +968,9 @@ _training_offloading_send_trained_model (ml_service_s * mls)
   if (training_s->trained_model_path == NULL)
     return;
 
-  if (!g_file_get_contents (training_s->trained_model_path, &contents, &len,
-          NULL)) {
-    _ml_error_report ("Failed to read file:%s", training_s->trained_model_path);
-    return;
+  if (training_s->delta_base) {
+    delta_base = _ml_replace_string (g_strdup (training_s->delta_base),
+        APP_RW_PATH, training_s->path, NULL, NULL);
   }
 
   list = g_hash_table_get_keys (training_s->transfer_data_table);
@@ -860,7 +978,17 @@ _training_offloading_send_trained_model (ml_service_s * mls)
   if (list) {
     _ml_logd ("Send trained model");
     for (iter = list; iter != NULL; iter = g_list_next (iter)) {
-      _request_offloading_service (mls, iter->data, contents, len);
+      /* Send the changed blocks only, if the remote sender has the base model. */
+      if (delta_base) {
+        ret = _ml_service_offloading_request_file_delta (mls, iter->data,
+            training_s->trained_model_path, delta_base);
+      } else {
+        ret = _ml_service_offloading_request_file (mls, iter->data,
+            training_s->trained_model_path);
+      }
+      if (ret != ML_ERROR_NONE)
+        _ml_error_report ("Failed to send trained model to '%s'.",
+            (gchar *) iter->data);
     }
 
     g_list_free (list);
@@ -868,7 +996,6 @@ _training_offloading_send_trained_model (ml_service_s * mls)
     _ml_error_report ("Failed to get transfer data table.");
   }
 
-  g_free (contents);
   return;
 }
 
@@ -892,11 +1019,6 @@ _ml_service_training_offloading_destroy (ml_service_s * mls)
   g_cond_clear (&training_s->received_cond);
   g_mutex_clear (&training_s->received_lock);
 
-  if (training_s->received_thread) {
-    g_thread_join (training_s->received_thread);
-    training_s->received_thread = NULL;
-  }
-
   if (training_s->transfer_data_table) {
     g_hash_table_destroy (training_s->transfer_data_table);
     training_s->transfer_data_table = NULL;
@@ -922,6 +1044,9 @@ _ml_service_training_offloading_destroy (ml_service_s * mls)
   g_free (training_s->trained_model_path);
   training_s->trained_model_path = NULL;
 
+  g_free (training_s->delta_base);
+  training_s->delta_base = NULL;
+
   g_free (training_s->receiver_pipe_json_str);
   training_s->receiver_pipe_json_str = NULL;
 
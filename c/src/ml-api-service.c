@@ -288,7 +288,10 @@ _ml_service_get_type (JsonObject * object)
 
   /** @todo add more services such as training offloading, offloading service */
   if (json_object_has_member (object, "single") ||
-      json_object_has_member (object, "pipeline")) {
+      json_object_has_member (object, "pipeline") ||
+      json_object_has_member (object, "graph") ||
+      json_object_has_member (object, "cascade") ||
+      json_object_has_member (object, "variants")) {
     type = ML_SERVICE_TYPE_EXTENSION;
   } else if (json_object_has_member (object, "offloading")) {
     type = ML_SERVICE_TYPE_OFFLOADING;
@@ -677,6 +680,18 @@ ml_service_get_information (ml_service_h handle, const char *name, char **value)
 
   g_mutex_lock (&mls->lock);
   status = ml_option_get (mls->information, name, (void **) (&val));
+  if (status == ML_ERROR_NONE) {
+    val = g_strdup (val);
+  } else if (mls->type == ML_SERVICE_TYPE_EXTENSION) {
+    /* Runtime information such as the statistics of the requests. */
+    status = _ml_service_extension_get_information (mls, name, &val);
+  } else if (mls->type == ML_SERVICE_TYPE_CLIENT_QUERY) {
+    /* Runtime information such as the statistics of the query servers. */
+    status = _ml_service_query_get_information (mls, name, &val);
+  } else if (mls->type == ML_SERVICE_TYPE_OFFLOADING) {
+    /* Runtime information such as the statistics of the compression. */
+    status = _ml_service_offloading_get_information (mls, name, &val);
+  }
   g_mutex_unlock (&mls->lock);
 
   if (status != ML_ERROR_NONE) {
@@ -684,7 +699,7 @@ ml_service_get_information (ml_service_h handle, const char *name, char **value)
         "The ml-service handle does not include the information '%s'.", name);
   }
 
-  *value = g_strdup (val);
+  *value = val;
   return ML_ERROR_NONE;
 }
 
@@ -712,7 +727,8 @@ ml_service_request (ml_service_h handle, const char *name,
 
   switch (mls->type) {
     case ML_SERVICE_TYPE_EXTENSION:
-      status = _ml_service_extension_request (mls, name, data);
+      status = _ml_service_extension_request (mls, name, data,
+          ML_SERVICE_REQUEST_PRIORITY_NORMAL, 0U);
       break;
     case ML_SERVICE_TYPE_OFFLOADING:
       status = _ml_service_offloading_request (mls, name, data);
@@ -726,6 +742,78 @@ ml_service_request (ml_service_h handle, const char *name,
   return status;
 }
 
+/**
+ * @brief Adds an input data with priority and deadline to process the model in ml-service extension handle.
+ */
+int
+ml_service_request_with_priority (ml_service_h handle, const char *name,
+    const ml_tensors_data_h data, ml_service_request_priority_e priority,
+    unsigned int deadline)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  int status;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance, which is usually created by ml_service_new().");
+  }
+
+  if (!data) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data (ml_tensors_data_h), is NULL. It should be a valid ml_tensor_data_h instance, which is usually created by ml_tensors_data_create().");
+  }
+
+  if (priority < ML_SERVICE_REQUEST_PRIORITY_LOW ||
+      priority >= ML_SERVICE_REQUEST_PRIORITY_MAX) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, priority (%d), is invalid.", priority);
+  }
+
+  switch (mls->type) {
+    case ML_SERVICE_TYPE_EXTENSION:
+      status = _ml_service_extension_request (mls, name, data, priority,
+          deadline);
+      break;
+    default:
+      /* Invalid handle type. */
+      status = ML_ERROR_NOT_SUPPORTED;
+      break;
+  }
+
+  return status;
+}
+
+/**
+ * @brief Requests to reload the activated model of ml-service.
+ */
+int
+ml_service_reload (ml_service_h handle)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+  int status;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance, which is usually created by ml_service_new().");
+  }
+
+  switch (mls->type) {
+    case ML_SERVICE_TYPE_EXTENSION:
+      status = _ml_service_extension_reload (mls);
+      break;
+    default:
+      /* Invalid handle type. */
+      status = ML_ERROR_NOT_SUPPORTED;
+      break;
+  }
+
+  return status;
+}
+
 /**
  * @brief Destroys the handle for machine learning service.
  */
@@ -814,6 +902,41 @@ ml_service_query_request (ml_service_h handle, const ml_tensors_data_h input,
   return _ml_service_query_request (mls, input, output);
 }
 
+/**
+ * @brief Requests query client service an output with given input data asynchronously.
+ */
+int
+ml_service_query_request_async (ml_service_h handle,
+    const ml_tensors_data_h input, ml_service_query_cb cb, void *user_data)
+{
+  ml_service_s *mls = (ml_service_s *) handle;
+
+  check_feature_state (ML_FEATURE_SERVICE);
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!_ml_service_handle_is_valid (mls)) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a valid ml_service_h instance.");
+  }
+
+  if (mls->type != ML_SERVICE_TYPE_CLIENT_QUERY) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'handle' (ml_service_h), is invalid. It should be a query service handle created by ml_service_query_create().");
+  }
+
+  if (!input) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'input' (ml_tensors_data_h), is NULL. It should be a valid ml_tensors_data_h.");
+  }
+
+  if (!cb) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, 'cb' (ml_service_query_cb), is NULL. It should be a valid callback to get the output.");
+  }
+
+  return _ml_service_query_request_async (mls, input, cb, user_data);
+}
+
 /**
  * @brief Internal function to get json string member.
  */
@@ -79,6 +79,9 @@ NNSTREAMER_SRC_FILES += \
     $(ML_API_ROOT)/c/src/ml-api-service.c \
     $(ML_API_ROOT)/c/src/ml-api-service-agent-client.c \
     $(ML_API_ROOT)/c/src/ml-api-service-extension.c \
+    $(ML_API_ROOT)/c/src/ml-api-service-extension-graph.c \
+    $(ML_API_ROOT)/c/src/ml-api-service-extension-cascade.c \
+    $(ML_API_ROOT)/c/src/ml-api-service-extension-variant.c \
     $(NNSTREAMER_AGENT_SRCS) \
     $(MLOPS_AGENT_SRCS)
 
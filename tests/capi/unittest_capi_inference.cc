@@ -201,6 +201,47 @@ TEST (nnstreamer_capi_construct_destruct, dummy_03)
   EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
+/**
+ * @brief Test NNStreamer pipeline to set the scheduling attributes of streaming threads.
+ */
+TEST (nnstreamer_capi_construct_destruct, thread_option)
+{
+  const char *pipeline = "videotestsrc num_buffers=2 ! queue ! fakesink";
+  ml_pipeline_h handle;
+  ml_option_h option;
+  int status;
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "thread_name", g_strdup ("ml-pipe-test"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_set_thread_option (handle, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (100000); /* 100ms */
+
+  /* invalid value */
+  status = ml_option_set (option, "nice", g_strdup ("-100"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_set_thread_option (handle, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_set_thread_option (NULL, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_set_thread_option (handle, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
+}
+
 /**
  * @brief Test NNStreamer pipeline construct with non-existent filter
  */
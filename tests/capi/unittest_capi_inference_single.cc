@@ -1207,6 +1207,292 @@ skip_test:
   g_free (test_model);
 }
 
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Testcase to close the handle while the timed-out request is running in the worker pool.
+ */
+TEST (nnstreamer_capi_singleshot, close_after_timeout)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_timeout (single, 1);
+  if (status == ML_ERROR_NONE) {
+    status = ml_single_get_input_info (single, &in_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    input = output = NULL;
+    status = ml_tensors_data_create (in_info, &input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_TRUE (status == ML_ERROR_NONE || status == ML_ERROR_TIMED_OUT);
+    if (status == ML_ERROR_NONE)
+      ml_tensors_data_destroy (output);
+
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+  }
+
+  /* close waits for the worker and releases the pending request */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Invoke several models with the same input data concurrently.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_multi)
+{
+  const guint num_models = 3;
+  ml_single_h single[num_models];
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output[num_models];
+  ml_information_h stats;
+  gchar *value;
+  void *data;
+  size_t data_size;
+  guint i;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  for (i = 0; i < num_models; i++) {
+    status = ml_single_open (&single[i], test_model, NULL, NULL,
+        ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_single_get_input_info (single[0], &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke_multi (single, num_models, input, output,
+      SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < num_models; i++) {
+    EXPECT_TRUE (output[i] != NULL);
+
+    status = ml_tensors_data_get_tensor_data (output[i], 0, &data, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, 1001U);
+
+    ml_tensors_data_destroy (output[i]);
+  }
+
+  /* the handles accept next request */
+  status = ml_single_invoke_multi (single, num_models, input, output, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < num_models; i++) {
+    /* the statistics of each handle */
+    status = ml_single_get_statistics (single[i], &stats);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_information_get (stats, "count", (void **) &value);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_STREQ (value, "2");
+    status = ml_information_get (stats, "invoke_max", (void **) &value);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_GT (g_ascii_strtoll (value, NULL, 10), 0);
+    ml_information_destroy (stats);
+
+    ml_tensors_data_destroy (output[i]);
+    status = ml_single_close (single[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to invoke several models with invalid parameters.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_multi_n)
+{
+  ml_single_h single[2];
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output[2];
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single[0], test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  single[1] = single[0];
+
+  status = ml_single_get_input_info (single[0], &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke_multi (NULL, 1, input, output, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_invoke_multi (single, 0, input, output, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_invoke_multi (single, 1, NULL, output, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_invoke_multi (single, 1, input, NULL, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* duplicated handle */
+  status = ml_single_invoke_multi (single, 2, input, output, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single[0]);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Testcase to invoke other handles while the timed-out request keeps its worker in the shared worker pool.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_after_timeout)
+{
+  const guint num_models = 3;
+  ml_single_h single[num_models];
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  guint i;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  for (i = 0; i < num_models; i++) {
+    status = ml_single_open (&single[i], test_model, NULL, NULL,
+        ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_single_get_input_info (single[0], &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The first handle times out, and its invoke keeps running in the worker. */
+  status = ml_single_set_timeout (single[0], 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  output = NULL;
+  status = ml_single_invoke (single[0], input, &output);
+  EXPECT_TRUE (status == ML_ERROR_NONE || status == ML_ERROR_TIMED_OUT);
+  if (status == ML_ERROR_NONE)
+    ml_tensors_data_destroy (output);
+
+  /* Other handles still make progress with the shared workers. */
+  for (i = 1; i < num_models; i++) {
+    status = ml_single_set_timeout (single[i], SINGLE_DEF_TIMEOUT_MSEC);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    output = NULL;
+    status = ml_single_invoke (single[i], input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (output);
+  }
+
+  /* The first handle accepts next input after the timed-out invoke is done. */
+  status = ml_single_set_timeout (single[0], SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 100U; i++) {
+    output = NULL;
+    status = ml_single_invoke (single[0], input, &output);
+    if (status != ML_ERROR_TRY_AGAIN)
+      break;
+
+    g_usleep (10000);
+  }
+
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (status == ML_ERROR_NONE)
+    ml_tensors_data_destroy (output);
+
+  /* The last handle releases the shared worker pool. */
+  for (i = 0; i < num_models; i++) {
+    status = ml_single_close (single[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
  * @detail Testcase with multiple runs in parallel. Some of the
@@ -1951,17 +2237,163 @@ skip_test:
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case to set invalid property
+ * @detail Failure case to set invalid property
+ */
+TEST (nnstreamer_capi_singleshot, property_02_n)
+{
+  ml_single_h single;
+  int status;
+  char *prop_value = NULL;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* get invalid property */
+  status = ml_single_get_property (single, "unknown_prop", &prop_value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (prop_value);
+
+  /* set invalid property */
+  status = ml_single_set_property (single, "unknown_prop", "INVALID");
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  /* null params */
+  status = ml_single_set_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_set_property (single, NULL, "INVALID");
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, NULL, &prop_value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (prop_value);
+
+  /* dimension should be valid */
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_STREQ (prop_value, "3:224:224:1");
+  g_free (prop_value);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Set the scheduling attributes of the thread invoking the model.
+ */
+TEST (nnstreamer_capi_singleshot, property_thread_attr_p)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  int status;
+  char *prop_value;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* default */
+  status = ml_single_get_property (single, "thread-name", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "");
+  g_free (prop_value);
+
+  /* the attributes which do not need privilege */
+  status = ml_single_set_property (single, "thread-name", "ml-single-test");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_set_property (single, "cpu-affinity", "0");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_set_property (single, "sched-policy", "other");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "thread-name", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "ml-single-test");
+  g_free (prop_value);
+
+  status = ml_single_get_property (single, "cpu-affinity", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (prop_value, "0");
+  g_free (prop_value);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  input = output = NULL;
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invoke in the worker thread with the attributes */
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to set invalid scheduling attributes.
  */
-TEST (nnstreamer_capi_singleshot, property_02_n)
+TEST (nnstreamer_capi_singleshot, property_thread_attr_n)
 {
   ml_single_h single;
   int status;
-  char *prop_value = NULL;
 
   const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
   gchar *test_model;
 
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
   /* supposed to run test in build directory */
   if (root_path == NULL)
     root_path = "..";
@@ -1972,47 +2404,20 @@ TEST (nnstreamer_capi_singleshot, property_02_n)
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
-
-  /* get invalid property */
-  status = ml_single_get_property (single, "unknown_prop", &prop_value);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  g_free (prop_value);
-
-  /* set invalid property */
-  status = ml_single_set_property (single, "unknown_prop", "INVALID");
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  /* null params */
-  status = ml_single_set_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_single_set_property (single, NULL, "INVALID");
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_single_get_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_single_get_property (single, NULL, &prop_value);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  g_free (prop_value);
-
-  /* dimension should be valid */
-  status = ml_single_get_property (single, "input", &prop_value);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_STREQ (prop_value, "3:224:224:1");
-  g_free (prop_value);
+  status = ml_single_set_property (single, "cpu-affinity", "3-1");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_set_property (single, "nice", "100");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_set_property (single, "sched-policy", "deadline");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_set_property (single, "sched-priority", "0");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
   g_free (test_model);
 }
 
@@ -4321,6 +4726,290 @@ skip_test:
   g_free (test_model);
 }
 
+/**
+ * @brief Test ml_option with tensorflow-lite, warm up the model at open time.
+ */
+TEST (nnstreamer_capi_ml_option, warmup)
+{
+  int status;
+  ml_option_h option;
+  ml_single_h single;
+  ml_information_h stats;
+  gchar *value;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *test_model = g_build_filename (root_path, "tests", "test_models",
+      "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_option_set (option, "framework_name", (void *) "tensorflow-lite", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* invalid warmup count */
+  status = ml_option_set (option, "warmup", (void *) "1000", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_single_open_with_option (&single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_option_set (option, "warmup", (void *) "abc", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_single_open_with_option (&single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_option_set (option, "warmup", (void *) "-1", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_single_open_with_option (&single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_option_set (option, "warmup", (void *) "3", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_single_open_with_option (&single, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "warmup-count", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "3");
+  g_free (value);
+
+  status = ml_single_get_property (single, "warmup-cold-latency", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (g_ascii_strtoll (value, NULL, 10), 0);
+  g_free (value);
+
+  status = ml_single_get_property (single, "warmup-warm-latency", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (g_ascii_strtoll (value, NULL, 10), 0);
+  g_free (value);
+
+  /* The synthetic invokes are not collected in the statistics. */
+  status = ml_single_get_statistics (single, &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_information_get (stats, "count", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  ml_information_destroy (stats);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  status = ml_option_destroy (option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test to get the invoke latency statistics of single-shot handle.
+ */
+TEST (nnstreamer_capi_singleshot, statistics)
+{
+  int status;
+  ml_option_h option;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_information_h stats;
+  gchar *value, *invoke_max;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *test_model = g_build_filename (root_path, "tests", "test_models",
+      "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_option_set (option, "framework_name", (void *) "tensorflow-lite", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_single_open_with_option (&single, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (guint i = 0; i < 5U; i++) {
+    output = NULL;
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (output);
+  }
+
+  status = ml_single_get_statistics (single, &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_information_get (stats, "count", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "5");
+
+  status = ml_information_get (stats, "invoke_p50", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (g_ascii_strtoll (value, NULL, 10), 0);
+
+  status = ml_information_get (stats, "total_max", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (g_ascii_strtoll (value, NULL, 10), 0);
+
+  ml_information_destroy (stats);
+
+  status = ml_single_reset_statistics (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_statistics (single, &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_information_get (stats, "count", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  ml_information_destroy (stats);
+
+  /* The worker gives the time of the invoke with timeout. */
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  output = NULL;
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_get_statistics (single, &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_information_get (stats, "count", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+
+  status = ml_information_get (stats, "invoke_max", (void **) &invoke_max);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (g_ascii_strtoll (invoke_max, NULL, 10), 0);
+
+  status = ml_information_get (stats, "total_max", (void **) &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GE (g_ascii_strtoll (value, NULL, 10), g_ascii_strtoll (invoke_max, NULL, 10));
+
+  ml_information_destroy (stats);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  status = ml_option_destroy (option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test to get the statistics with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, statistics_n)
+{
+  int status;
+  ml_information_h stats;
+
+  status = ml_single_get_statistics (NULL, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_reset_statistics (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test ml_single_get_property with tensorflow-lite, get the time to open the model.
+ */
+TEST (nnstreamer_capi_ml_option, openTime)
+{
+  int status;
+  ml_option_h option;
+  ml_single_h single;
+  gchar *value;
+  gint64 open_start, open_total;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  gchar *test_model = g_build_filename (root_path, "tests", "test_models",
+      "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "models", test_model, NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_option_set (option, "framework_name", (void *) "tensorflow-lite", NULL);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_single_open_with_option (&single, option);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_property (single, "open-time-start", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  open_start = g_ascii_strtoll (value, NULL, 10);
+  g_free (value);
+
+  status = ml_single_get_property (single, "open-time-total", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  open_total = g_ascii_strtoll (value, NULL, 10);
+  g_free (value);
+
+  EXPECT_GT (open_total, 0);
+  EXPECT_LE (open_start, open_total);
+
+  /* The compiled-model cache is not supported. */
+  status = ml_single_get_property (single, "cache-hit", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  status = ml_option_destroy (option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
 #if defined(ENABLE_TENSORFLOW_LITE) || defined(ENABLE_TENSORFLOW2_LITE)
 /**
  * @brief Test ml_option with tensorflow-lite (manually set by ml_option_set, framework_name=tensorflow-lite)
@@ -157,6 +157,119 @@ TEST_F (MLServiceAgentTest, usecase_00)
   g_free (client_pipeline_desc);
 }
 
+/**
+ * @brief Internal function to wait for the pipelines launched in background, until the pool has given number of pipelines.
+ */
+static guint
+_wait_pipeline_pool (const gchar *name, guint expected)
+{
+  guint i, count = 0U;
+
+  for (i = 0; i < 100U; i++) {
+    if (ml_service_pipeline_get_pool_available (name, &count) != ML_ERROR_NONE
+        || count >= expected)
+      break;
+
+    g_usleep (50000);
+  }
+
+  return count;
+}
+
+/**
+ * @brief Test to launch the pipeline from the pool of pre-launched pipelines.
+ */
+TEST_F (MLServiceAgentTest, pipeline_pool)
+{
+  int status;
+  const gchar *service_name = "pipeline_pool_for_test";
+  const gchar *pipeline_desc = "videotestsrc ! fakesink async=false";
+  ml_service_h service;
+  ml_pipeline_state_e state;
+  guint count;
+
+  status = ml_service_pipeline_set (service_name, pipeline_desc);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_pipeline_set_pool_size (service_name, 2U);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  for (guint i = 0; i < 3U; i++) {
+    /* Wait for launching the pipelines in background. */
+    EXPECT_EQ (_wait_pipeline_pool (service_name, 2U), 2U);
+
+    status = ml_service_pipeline_launch (service_name, &service);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+
+    /* The pipeline is taken from the pool, and the pool is refilled in background. */
+    status = ml_service_pipeline_get_state (service, &state);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+    EXPECT_EQ (ML_PIPELINE_STATE_PAUSED, state);
+
+    status = ml_service_start (service);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+    status = ml_service_pipeline_get_state (service, &state);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+    EXPECT_EQ (ML_PIPELINE_STATE_PLAYING, state);
+
+    status = ml_service_destroy (service);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+  }
+
+  status = ml_service_pipeline_set_pool_size (service_name, 0U);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* The pool is disabled, the pipeline should be launched newly. */
+  status = ml_service_pipeline_get_pool_available (service_name, &count);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_EQ (count, 0U);
+
+  status = ml_service_pipeline_launch (service_name, &service);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_service_destroy (service);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* Release all pools explicitly. */
+  status = ml_service_pipeline_set_pool_size (service_name, 1U);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_EQ (_wait_pipeline_pool (service_name, 1U), 1U);
+
+  status = ml_service_pipeline_clear_pools ();
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_pipeline_get_pool_available (service_name, &count);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_EQ (count, 0U);
+
+  status = ml_service_pipeline_delete (service_name);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+}
+
+/**
+ * @brief Test ml_service_pipeline_set_pool_size with invalid param.
+ */
+TEST_F (MLServiceAgentTest, pipeline_pool_00_n)
+{
+  int status;
+  guint count;
+
+  status = ml_service_pipeline_set_pool_size (NULL, 1U);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_pipeline_set_pool_size ("some_pipeline_name", 100U);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  /* The pipeline is not registered. */
+  status = ml_service_pipeline_set_pool_size ("some_pipeline_name", 1U);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_pipeline_get_pool_available (NULL, &count);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_pipeline_get_pool_available ("some_pipeline_name", NULL);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+}
+
 /**
  * @brief use case of using service api and agent
  */
@@ -685,6 +798,703 @@ TEST_F (MLServiceAgentTest, query_client)
   ml_tensors_info_destroy (in_info);
 }
 
+/**
+ * @brief Internal function to create the option of query client for test.
+ */
+static ml_option_h
+_create_query_client_option (guint dest_port)
+{
+  ml_option_h option = NULL;
+  guint *port, *timeout;
+
+  ml_option_create (&option);
+
+  ml_option_set (option, "host", g_strdup ("localhost"), g_free);
+
+  port = g_new0 (guint, 1);
+  *port = get_available_port ();
+  ml_option_set (option, "port", port, g_free);
+
+  ml_option_set (option, "dest-host", g_strdup ("localhost"), g_free);
+
+  port = g_new0 (guint, 1);
+  *port = dest_port;
+  ml_option_set (option, "dest-port", port, g_free);
+
+  ml_option_set (option, "connect-type", g_strdup ("TCP"), g_free);
+
+  timeout = g_new0 (guint, 1);
+  *timeout = 10000U;
+  ml_option_set (option, "timeout", timeout, g_free);
+
+  ml_option_set (option, "caps",
+      g_strdup ("other/tensors,num_tensors=1,format=static,types=uint8,dimensions=3:4:4:1,framerate=0/1"),
+      g_free);
+
+  return option;
+}
+
+/**
+ * @brief Internal function to construct query server pipeline for test.
+ */
+static ml_pipeline_h
+_create_query_server (guint port)
+{
+  ml_pipeline_h pipe = NULL;
+  g_autofree gchar *desc = g_strdup_printf (
+      "tensor_query_serversrc port=%u ! other/tensors,num_tensors=1,dimensions=3:4:4:1,types=uint8,format=static,framerate=0/1 ! tensor_query_serversink async=false sync=false",
+      port);
+
+  if (ml_pipeline_construct (desc, NULL, NULL, &pipe) != ML_ERROR_NONE)
+    return NULL;
+
+  ml_pipeline_start (pipe);
+  return pipe;
+}
+
+/**
+ * @brief Internal function to construct query server pipeline which never returns the output, for test.
+ */
+static ml_pipeline_h
+_create_query_server_no_output (guint port)
+{
+  ml_pipeline_h pipe = NULL;
+  g_autofree gchar *desc = g_strdup_printf (
+      "tensor_query_serversrc port=%u ! other/tensors,num_tensors=1,dimensions=3:4:4:1,types=uint8,format=static,framerate=0/1 ! valve drop=true ! tensor_query_serversink async=false sync=false",
+      port);
+
+  if (ml_pipeline_construct (desc, NULL, NULL, &pipe) != ML_ERROR_NONE)
+    return NULL;
+
+  ml_pipeline_start (pipe);
+  return pipe;
+}
+
+/**
+ * @brief Internal structure to request query in multiple threads.
+ */
+typedef struct {
+  ml_service_h client;
+  guint id;
+  guint matched;
+} query_thread_data_s;
+
+/**
+ * @brief Internal function to request query in thread.
+ */
+static gpointer
+_query_request_thread (gpointer data)
+{
+  query_thread_data_s *tdata = (query_thread_data_s *) data;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  uint8_t *received;
+  size_t size;
+  int i, status;
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  for (i = 0; i < 5; i++) {
+    uint8_t test_data = (uint8_t) (tdata->id * 10 + i);
+
+    ml_tensors_data_set_tensor_data (input, 0, &test_data, sizeof (uint8_t));
+
+    status = ml_service_query_request (tdata->client, input, &output);
+    if (status == ML_ERROR_NONE) {
+      ml_tensors_data_get_tensor_data (output, 0, (void **) &received, &size);
+      if (received[0] == test_data)
+        tdata->matched++;
+
+      ml_tensors_data_destroy (output);
+    }
+  }
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  return NULL;
+}
+
+/**
+ * @brief Test query client with concurrent requests, each request should get its own output.
+ */
+TEST_F (MLServiceAgentTest, query_client_concurrent)
+{
+  ml_pipeline_h server;
+  ml_service_h client;
+  ml_option_h option;
+  query_thread_data_s tdata[4];
+  GThread *threads[4];
+  guint i, server_port;
+  int status;
+
+  server_port = get_available_port ();
+  EXPECT_TRUE (server_port > 0);
+
+  server = _create_query_server (server_port);
+  ASSERT_TRUE (server != NULL);
+
+  option = _create_query_client_option (server_port);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  for (i = 0; i < 4; i++) {
+    tdata[i].client = client;
+    tdata[i].id = i;
+    tdata[i].matched = 0;
+    threads[i] = g_thread_new ("query-test", _query_request_thread, &tdata[i]);
+  }
+
+  for (i = 0; i < 4; i++) {
+    g_thread_join (threads[i]);
+    EXPECT_EQ (tdata[i].matched, 5U);
+  }
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_pipeline_stop (server);
+  ml_pipeline_destroy (server);
+  ml_option_destroy (option);
+}
+
+/**
+ * @brief Internal structure to get the output of asynchronous query request.
+ */
+typedef struct {
+  GMutex lock;
+  GCond cond;
+  guint received;
+  guint matched;
+  guint8 expected[5];
+} query_async_data_s;
+
+/**
+ * @brief Callback for asynchronous query request.
+ */
+static void
+_query_async_cb (int status, const ml_tensors_data_h output, void *user_data)
+{
+  query_async_data_s *adata = (query_async_data_s *) user_data;
+  uint8_t *received;
+  size_t size;
+
+  g_mutex_lock (&adata->lock);
+  if (status == ML_ERROR_NONE) {
+    ml_tensors_data_get_tensor_data (output, 0, (void **) &received, &size);
+    if (adata->received < 5 && received[0] == adata->expected[adata->received])
+      adata->matched++;
+  }
+
+  adata->received++;
+  g_cond_signal (&adata->cond);
+  g_mutex_unlock (&adata->lock);
+}
+
+/**
+ * @brief Test query client with asynchronous requests.
+ */
+TEST_F (MLServiceAgentTest, query_client_async)
+{
+  ml_pipeline_h server;
+  ml_service_h client;
+  ml_option_h option;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  query_async_data_s adata;
+  guint *max_outstanding;
+  guint i, server_port;
+  gint64 end_time;
+  int status;
+
+  server_port = get_available_port ();
+  EXPECT_TRUE (server_port > 0);
+
+  server = _create_query_server (server_port);
+  ASSERT_TRUE (server != NULL);
+
+  option = _create_query_client_option (server_port);
+  max_outstanding = g_new0 (guint, 1);
+  *max_outstanding = 5U;
+  ml_option_set (option, "max-outstanding", max_outstanding, g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  g_mutex_init (&adata.lock);
+  g_cond_init (&adata.cond);
+  adata.received = adata.matched = 0;
+
+  for (i = 0; i < 5; i++) {
+    adata.expected[i] = (guint8) (i + 1);
+    ml_tensors_data_set_tensor_data (input, 0, &adata.expected[i], sizeof (uint8_t));
+
+    status = ml_service_query_request_async (client, input, _query_async_cb, &adata);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+  }
+
+  end_time = g_get_monotonic_time () + 10 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&adata.lock);
+  while (adata.received < 5) {
+    if (!g_cond_wait_until (&adata.cond, &adata.lock, end_time))
+      break;
+  }
+  g_mutex_unlock (&adata.lock);
+
+  EXPECT_EQ (adata.received, 5U);
+  EXPECT_EQ (adata.matched, 5U);
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  g_mutex_clear (&adata.lock);
+  g_cond_clear (&adata.cond);
+
+  ml_pipeline_stop (server);
+  ml_pipeline_destroy (server);
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+}
+
+/**
+ * @brief Test query client with asynchronous requests, more than max outstanding requests.
+ */
+TEST_F (MLServiceAgentTest, query_client_async_max_outstanding_n)
+{
+  ml_pipeline_h server;
+  ml_service_h client;
+  ml_option_h option;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  query_async_data_s adata;
+  guint *max_outstanding, *timeout;
+  guint server_port;
+  gint64 end_time;
+  int status;
+
+  server_port = get_available_port ();
+  EXPECT_TRUE (server_port > 0);
+
+  /* The server does not return the output, the first request remains outstanding. */
+  server = _create_query_server_no_output (server_port);
+  ASSERT_TRUE (server != NULL);
+
+  option = _create_query_client_option (server_port);
+  max_outstanding = g_new0 (guint, 1);
+  *max_outstanding = 1U;
+  ml_option_set (option, "max-outstanding", max_outstanding, g_free);
+
+  timeout = g_new0 (guint, 1);
+  *timeout = 1000U;
+  ml_option_set (option, "timeout", timeout, g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  g_mutex_init (&adata.lock);
+  g_cond_init (&adata.cond);
+  adata.received = adata.matched = 0;
+  adata.expected[0] = 1U;
+  ml_tensors_data_set_tensor_data (input, 0, &adata.expected[0], sizeof (uint8_t));
+
+  status = ml_service_query_request_async (client, input, _query_async_cb, &adata);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_query_request_async (client, input, _query_async_cb, &adata);
+  EXPECT_EQ (ML_ERROR_TRY_AGAIN, status);
+
+  /* Wait for the timeout of the first request. */
+  end_time = g_get_monotonic_time () + 10 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&adata.lock);
+  while (adata.received < 1) {
+    if (!g_cond_wait_until (&adata.cond, &adata.lock, end_time))
+      break;
+  }
+  g_mutex_unlock (&adata.lock);
+
+  EXPECT_EQ (adata.received, 1U);
+  EXPECT_EQ (adata.matched, 0U);
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  g_mutex_clear (&adata.lock);
+  g_cond_clear (&adata.cond);
+
+  ml_pipeline_stop (server);
+  ml_pipeline_destroy (server);
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+}
+
+/**
+ * @brief Internal callback to get the status of asynchronous query request.
+ */
+static void
+_query_async_status_cb (int status, const ml_tensors_data_h output, void *user_data)
+{
+  query_async_data_s *adata = (query_async_data_s *) user_data;
+
+  g_mutex_lock (&adata->lock);
+  if (status == ML_ERROR_TIMED_OUT && output == NULL)
+    adata->matched++;
+
+  adata->received++;
+  g_cond_signal (&adata->cond);
+  g_mutex_unlock (&adata->lock);
+}
+
+/**
+ * @brief Test query client with asynchronous request, the callback is called with timeout error.
+ */
+TEST_F (MLServiceAgentTest, query_client_async_timeout_n)
+{
+  ml_pipeline_h server;
+  ml_service_h client;
+  ml_option_h option;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  query_async_data_s adata;
+  guint *timeout;
+  guint server_port;
+  gint64 start_time, end_time;
+  gchar *value;
+  int status;
+
+  server_port = get_available_port ();
+  EXPECT_TRUE (server_port > 0);
+
+  server = _create_query_server_no_output (server_port);
+  ASSERT_TRUE (server != NULL);
+
+  option = _create_query_client_option (server_port);
+  timeout = g_new0 (guint, 1);
+  *timeout = 500U;
+  ml_option_set (option, "timeout", timeout, g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  g_mutex_init (&adata.lock);
+  g_cond_init (&adata.cond);
+  adata.received = adata.matched = 0;
+  adata.expected[0] = 1U;
+  ml_tensors_data_set_tensor_data (input, 0, &adata.expected[0], sizeof (uint8_t));
+
+  start_time = g_get_monotonic_time ();
+  status = ml_service_query_request_async (client, input, _query_async_status_cb, &adata);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  end_time = start_time + 10 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&adata.lock);
+  while (adata.received < 1) {
+    if (!g_cond_wait_until (&adata.cond, &adata.lock, end_time))
+      break;
+  }
+  g_mutex_unlock (&adata.lock);
+
+  /* The callback is called with timeout error, not before the given timeout. */
+  EXPECT_EQ (adata.received, 1U);
+  EXPECT_EQ (adata.matched, 1U);
+  EXPECT_GE (g_get_monotonic_time () - start_time, 500 * G_TIME_SPAN_MILLISECOND);
+
+  status = ml_service_get_information (client, "timeouts_0", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  g_mutex_clear (&adata.lock);
+  g_cond_clear (&adata.cond);
+
+  ml_pipeline_stop (server);
+  ml_pipeline_destroy (server);
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+}
+
+/**
+ * @brief Test query client with multiple query servers.
+ */
+TEST_F (MLServiceAgentTest, query_client_endpoints)
+{
+  ml_pipeline_h server1, server2;
+  ml_service_h client;
+  ml_option_h option;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  guint i, port1, port2, matched = 0;
+  guint64 requests1, requests2;
+  uint8_t *received;
+  size_t size;
+  gchar *value;
+  int status;
+
+  port1 = get_available_port ();
+  EXPECT_TRUE (port1 > 0);
+  server1 = _create_query_server (port1);
+  ASSERT_TRUE (server1 != NULL);
+
+  port2 = get_available_port ();
+  EXPECT_TRUE (port2 > 0);
+  server2 = _create_query_server (port2);
+  ASSERT_TRUE (server2 != NULL);
+
+  option = _create_query_client_option (port1);
+  ml_option_set (option, "endpoints",
+      g_strdup_printf ("localhost:%u, localhost:%u", port1, port2), g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  for (i = 0; i < 10; i++) {
+    uint8_t test_data = (uint8_t) i;
+
+    ml_tensors_data_set_tensor_data (input, 0, &test_data, sizeof (uint8_t));
+
+    status = ml_service_query_request (client, input, &output);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+
+    if (status == ML_ERROR_NONE) {
+      ml_tensors_data_get_tensor_data (output, 0, (void **) &received, &size);
+      if (received[0] == test_data)
+        matched++;
+
+      ml_tensors_data_destroy (output);
+    }
+  }
+
+  EXPECT_EQ (matched, 10U);
+
+  status = ml_service_get_information (client, "endpoint_count", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  /* Both servers should be used, the server without latency is selected first. */
+  status = ml_service_get_information (client, "requests_0", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  requests1 = g_ascii_strtoull (value, NULL, 10);
+  g_free (value);
+
+  status = ml_service_get_information (client, "requests_1", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  requests2 = g_ascii_strtoull (value, NULL, 10);
+  g_free (value);
+
+  EXPECT_TRUE (requests1 > 0U);
+  EXPECT_TRUE (requests2 > 0U);
+  EXPECT_EQ (requests1 + requests2, 10U);
+
+  status = ml_service_get_information (client, "latency_avg_2", &value);
+  EXPECT_NE (ML_ERROR_NONE, status);
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_pipeline_stop (server1);
+  ml_pipeline_destroy (server1);
+  ml_pipeline_stop (server2);
+  ml_pipeline_destroy (server2);
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+}
+
+/**
+ * @brief Internal function to get the statistics of query client as a number.
+ */
+static guint64
+_get_query_stat (ml_service_h client, const gchar *name)
+{
+  gchar *value = NULL;
+  guint64 stat = 0;
+
+  if (ml_service_get_information (client, name, &value) == ML_ERROR_NONE) {
+    stat = g_ascii_strtoull (value, NULL, 10);
+    g_free (value);
+  }
+
+  return stat;
+}
+
+/**
+ * @brief Internal function to send the query request and check the output.
+ */
+static gboolean
+_request_query (ml_service_h client, ml_tensors_data_h input, uint8_t test_data)
+{
+  ml_tensors_data_h output;
+  uint8_t *received;
+  size_t size;
+  gboolean matched = FALSE;
+
+  ml_tensors_data_set_tensor_data (input, 0, &test_data, sizeof (uint8_t));
+
+  if (ml_service_query_request (client, input, &output) == ML_ERROR_NONE) {
+    ml_tensors_data_get_tensor_data (output, 0, (void **) &received, &size);
+    matched = (received[0] == test_data);
+    ml_tensors_data_destroy (output);
+  }
+
+  return matched;
+}
+
+/**
+ * @brief Test query client with multiple query servers, one server does not respond.
+ */
+TEST_F (MLServiceAgentTest, query_client_endpoints_failover)
+{
+  ml_pipeline_h server1, server2;
+  ml_service_h client;
+  ml_option_h option;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  ml_tensor_dimension in_dim = { 3, 4, 4, 1 };
+  guint *timeout;
+  guint i, port1, port2, matched = 0;
+  guint64 requests;
+  int status;
+
+  /* The first server is down, it does not return the output. */
+  port1 = get_available_port ();
+  EXPECT_TRUE (port1 > 0);
+  server1 = _create_query_server_no_output (port1);
+  ASSERT_TRUE (server1 != NULL);
+
+  port2 = get_available_port ();
+  EXPECT_TRUE (port2 > 0);
+  server2 = _create_query_server (port2);
+  ASSERT_TRUE (server2 != NULL);
+
+  option = _create_query_client_option (port1);
+  ml_option_set (option, "endpoints",
+      g_strdup_printf ("localhost:%u, localhost:%u", port1, port2), g_free);
+
+  timeout = g_new0 (guint, 1);
+  *timeout = 500U;
+  ml_option_set (option, "timeout", timeout, g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_data_create (in_info, &input);
+
+  /* The request is timed out in the first server, and fails over to the healthy server. */
+  for (i = 0; i < 10; i++) {
+    if (_request_query (client, input, (uint8_t) i))
+      matched++;
+
+    if (_get_query_stat (client, "timeouts_0") >= 3U)
+      break;
+  }
+
+  ASSERT_LT (i, 10U);
+  EXPECT_EQ (matched, i + 1);
+  EXPECT_EQ (_get_query_stat (client, "timeouts_0"), 3U);
+  EXPECT_EQ (_get_query_stat (client, "responses_0"), 0U);
+  EXPECT_EQ (_get_query_stat (client, "responses_1"), matched);
+
+  /* After 3 timeouts, the first server is unhealthy and the requests go to the healthy server. */
+  requests = _get_query_stat (client, "requests_0");
+  for (i = 0; i < 5; i++) {
+    if (_request_query (client, input, (uint8_t) (i + 10)))
+      matched++;
+  }
+
+  EXPECT_EQ (_get_query_stat (client, "requests_0"), requests);
+  EXPECT_EQ (_get_query_stat (client, "responses_1"), matched);
+
+  /* The unhealthy server is checked again after the back-off interval (1 sec). */
+  g_usleep (1100000);
+
+  if (_request_query (client, input, 20U))
+    matched++;
+
+  EXPECT_EQ (_get_query_stat (client, "requests_0"), requests + 1);
+  EXPECT_EQ (_get_query_stat (client, "timeouts_0"), 4U);
+  EXPECT_EQ (_get_query_stat (client, "responses_1"), matched);
+
+  /* The back-off interval is not passed yet, the request goes to the healthy server. */
+  if (_request_query (client, input, 21U))
+    matched++;
+
+  EXPECT_EQ (_get_query_stat (client, "requests_0"), requests + 1);
+  EXPECT_EQ (_get_query_stat (client, "responses_1"), matched);
+  EXPECT_EQ (_get_query_stat (client, "endpoint_count"), 2U);
+
+  status = ml_service_destroy (client);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  ml_pipeline_stop (server1);
+  ml_pipeline_destroy (server1);
+  ml_pipeline_stop (server2);
+  ml_pipeline_destroy (server2);
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+}
+
+/**
+ * @brief Test ml_service_query_create with invalid endpoints.
+ */
+TEST_F (MLServiceAgentTest, query_create_endpoints_n)
+{
+  ml_service_h client;
+  ml_option_h option;
+  int status;
+
+  option = _create_query_client_option (get_available_port ());
+  ml_option_set (option, "endpoints", g_strdup ("localhost"), g_free);
+
+  status = ml_service_query_create (option, &client);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  ml_option_destroy (option);
+}
+
 /**
  * @brief Test ml_service_query_create with invalid param.
  */
@@ -792,6 +1602,11 @@ TEST_F (MLServiceAgentTest, query_request_00_n)
   status = ml_service_query_request (handle, in_data, NULL);
   EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
 
+  status = ml_service_query_request_async (NULL, in_data, _query_async_cb, NULL);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+  status = ml_service_query_request_async (handle, in_data, _query_async_cb, NULL);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
   ml_service_destroy (handle);
   ml_service_pipeline_delete ("key");
   ml_tensors_data_destroy (in_data);
@@ -940,6 +1755,97 @@ TEST_F (MLServiceAgentTest, model_get_activated_00_n)
   EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
 }
 
+/**
+ * @brief Test ml_service_model_get_activated_multi with invalid param.
+ */
+TEST_F (MLServiceAgentTest, model_get_activated_multi_00_n)
+{
+  int status;
+
+  const gchar *names[] = { "some_model_name", NULL };
+  ml_information_h info_h[2] = { NULL, NULL };
+
+  status = ml_service_model_get_activated_multi (NULL, 1U, info_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_model_get_activated_multi (names, 0U, info_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_model_get_activated_multi (names, 1U, NULL);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_model_get_activated_multi (names, 2U, info_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_model_get_activated_multi (names, 1U, info_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+  EXPECT_EQ (info_h[0], nullptr);
+}
+
+/**
+ * @brief Test ml_service_model_get_activated_multi, the cached information is updated when the model is activated.
+ */
+TEST_F (MLServiceAgentTest, model_get_activated_multi)
+{
+  int status;
+  const gchar *keys[] = { "mobilenet_v1_multi", "add_multi" };
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  ml_information_h info_h[2] = { NULL, NULL };
+  gchar *path;
+  unsigned int version;
+
+  /* ml_service_model_register() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *test_model1 = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  g_autofree gchar *test_model2 = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+
+  ml_service_model_delete (keys[0], 0U);
+  ml_service_model_delete (keys[1], 0U);
+
+  status = ml_service_model_register (keys[0], test_model1, true, NULL, &version);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_service_model_register (keys[1], test_model2, true, NULL, &version);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_model_get_activated_multi (keys, 2U, info_h);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_information_get (info_h[0], "path", (void **) &path);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (path, test_model1);
+  status = ml_information_get (info_h[1], "path", (void **) &path);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (path, test_model2);
+
+  ml_information_destroy (info_h[0]);
+  ml_information_destroy (info_h[1]);
+
+  /* Activate other version, the cache should not return the old model. */
+  status = ml_service_model_register (keys[0], test_model2, false, NULL, &version);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_service_model_activate (keys[0], version);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_model_get_activated_multi (keys, 2U, info_h);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_information_get (info_h[0], "path", (void **) &path);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (path, test_model2);
+
+  ml_information_destroy (info_h[0]);
+  ml_information_destroy (info_h[1]);
+
+  status = ml_service_model_delete (keys[0], 0U);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  status = ml_service_model_delete (keys[1], 0U);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+}
+
 /**
  * @brief Test ml_service_model_get_all with invalid param.
  */
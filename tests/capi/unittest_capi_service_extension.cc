@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <glib.h>
+#include <glib/gstdio.h>
 
 #include <ml-api-service-private.h>
 #include <ml-api-service.h>
@@ -530,6 +531,479 @@ TEST_F_REQUIRE_TFLITE (MLServiceExtensionTest, scenarioConfig5ImgClf)
   ml_service_pipeline_delete (test_name);
 }
 
+/**
+ * @brief Usage of ml-service extension API, reload the activated model.
+ */
+TEST_F_REQUIRE_TFLITE (MLServiceExtensionTest, reloadActivatedModel)
+{
+  ml_service_h handle;
+  int status;
+
+  const char test_name[] = "test-single-imgclf";
+  unsigned int version = 0U;
+  g_autofree gchar *config = get_config_path ("config_single_imgclf_key.conf");
+  g_autofree gchar *model = _get_model_path ("mobilenet_v1_1.0_224_quant.tflite");
+  g_autofree gchar *contents = NULL;
+  g_autofree gchar *tmp_dir = NULL;
+  g_autofree gchar *tmp_model = NULL;
+  gchar *path = NULL;
+  gsize len = 0;
+  int tried;
+
+  /* Register test model. */
+  ml_service_model_delete (test_name, 0U);
+  ml_service_model_register (test_name, model, true, NULL, &version);
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* Register and activate new version of the model. */
+  tmp_dir = g_dir_make_tmp ("ml-ext-reload-XXXXXX", NULL);
+  ASSERT_TRUE (tmp_dir != NULL);
+
+  tmp_model = g_build_filename (tmp_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_get_contents (model, &contents, &len, NULL));
+  ASSERT_TRUE (g_file_set_contents (tmp_model, contents, len, NULL));
+
+  ml_service_model_register (test_name, tmp_model, true, NULL, &version);
+
+  status = ml_service_get_information (handle, "model_path", &path);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (path, model);
+  g_free (path);
+
+  status = ml_service_reload (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The requests are processed while the model is reloaded. */
+  _extension_test_imgclf (handle, FALSE);
+
+  /* The handle is swapped with the newly activated model. */
+  tried = 0;
+  do {
+    path = NULL;
+    status = ml_service_get_information (handle, "model_path", &path);
+    if (status == ML_ERROR_NONE && g_strcmp0 (path, tmp_model) == 0)
+      break;
+
+    g_free (path);
+    path = NULL;
+    g_usleep (50000U);
+  } while (tried++ < 20);
+
+  EXPECT_STREQ (path, tmp_model);
+  g_free (path);
+
+  /* The new model processes the requests after the reload. */
+  _extension_test_imgclf (handle, FALSE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Clear test model. */
+  ml_service_model_delete (test_name, 0U);
+  g_remove (tmp_model);
+  g_rmdir (tmp_dir);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, reloadInvalidParam_n)
+{
+  ml_service_h handle;
+  int status;
+
+  g_autofree gchar *config = get_config_path ("config_single_add.conf");
+
+  status = ml_service_reload (NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* The configuration does not include the model key. */
+  status = ml_service_reload (handle);
+  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Usage of ml-service extension API with result cache.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, scenarioConfigAddCache)
+{
+  extension_test_data_s *tdata;
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  char *value;
+  int i, status, tried;
+  float tmp_input[] = { 1.0f };
+
+  g_autofree gchar *config = get_config_path ("config_single_add_cache.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  tdata = _create_test_data (FALSE);
+  ASSERT_TRUE (tdata != NULL);
+
+  status = ml_service_set_event_cb (handle, _extension_test_add_cb, tdata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_service_get_input_information (handle, NULL, &info);
+  ml_tensors_data_create (info, &input);
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+
+  /* Push same input, the results except the first one are from the cache. */
+  for (i = 0; i < 3; i++) {
+    g_usleep (50000U);
+
+    status = ml_service_request (handle, NULL, input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (tdata->received < 3 && tried++ < 10);
+
+  EXPECT_EQ (tdata->received, 3);
+
+  status = ml_service_get_information (handle, "cache_hit", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cache_miss", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cache_eviction", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cache_bytes", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "8");
+  g_free (value);
+
+  /* Clear callback before releasing tdata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+  _free_test_data (tdata);
+}
+
+/**
+ * @brief Callback function for graph test.
+ */
+static void
+_extension_test_graph_cb (ml_service_event_e event, ml_information_h event_data, void *user_data)
+{
+  extension_test_data_s *tdata = (extension_test_data_s *) user_data;
+  ml_tensors_data_h data = NULL;
+  gchar *name = NULL;
+  void *_raw = NULL;
+  size_t _size = 0;
+  int status;
+
+  switch (event) {
+    case ML_SERVICE_EVENT_NEW_DATA:
+      ASSERT_TRUE (event_data != NULL);
+
+      status = ml_information_get (event_data, "name", (void **) (&name));
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_TRUE (g_str_equal (name, "add_second") || g_str_equal (name, "add_third"));
+
+      status = ml_information_get (event_data, "data", &data);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+
+      status = ml_tensors_data_get_tensor_data (data, 0U, &_raw, &_size);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+
+      /* (input 1.0 + invoke 2.0 + invoke 2.0) */
+      EXPECT_EQ (((float *) _raw)[0], 5.0f);
+
+      if (tdata)
+        tdata->received++;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Usage of ml-service extension API with the graph of models.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, scenarioConfigGraphAdd)
+{
+  extension_test_data_s *tdata;
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  int i, status, tried;
+  float tmp_input[] = { 1.0f };
+
+  g_autofree gchar *config = get_config_path ("config_graph_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  tdata = _create_test_data (TRUE);
+  ASSERT_TRUE (tdata != NULL);
+
+  status = ml_service_set_event_cb (handle, _extension_test_graph_cb, tdata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_get_input_information (handle, NULL, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (info);
+
+  /* The node in the middle of the graph is not the input of the graph. */
+  status = ml_service_get_input_information (handle, "add_second", &info);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_service_get_input_information (handle, "add_first", &info);
+  ml_tensors_data_create (info, &input);
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+
+  for (i = 0; i < 3; i++) {
+    g_usleep (50000U);
+
+    status = ml_service_request (handle, NULL, input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* Each request invokes new-data event for 2 output nodes. */
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (tdata->received < 6 && tried++ < 10);
+
+  EXPECT_EQ (tdata->received, 6);
+
+  /* Clear callback before releasing tdata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+  _free_test_data (tdata);
+}
+
+/**
+ * @brief Callback function for cascade test.
+ */
+static void
+_extension_test_cascade_cb (ml_service_event_e event, ml_information_h event_data, void *user_data)
+{
+  extension_test_data_s *tdata = (extension_test_data_s *) user_data;
+  ml_tensors_data_h data = NULL;
+  gchar *name = NULL;
+  void *_raw = NULL;
+  size_t _size = 0;
+  int status;
+
+  switch (event) {
+    case ML_SERVICE_EVENT_NEW_DATA:
+      ASSERT_TRUE (event_data != NULL);
+
+      status = ml_information_get (event_data, "name", (void **) (&name));
+      EXPECT_EQ (status, ML_ERROR_NONE);
+
+      status = ml_information_get (event_data, "data", &data);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+
+      status = ml_tensors_data_get_tensor_data (data, 0U, &_raw, &_size);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+
+      /* The first stage gives confident result (>= 4.0) for the input 3.0, the last stage processes the input 1.0. */
+      if (g_str_equal (name, "add_small"))
+        EXPECT_EQ (((float *) _raw)[0], 5.0f);
+      else
+        EXPECT_EQ (((float *) _raw)[0], 3.0f);
+
+      if (tdata)
+        tdata->received++;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Usage of ml-service extension API with the cascade of models.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, scenarioConfigCascadeAdd)
+{
+  extension_test_data_s *tdata;
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  int status, tried;
+  gchar *value;
+  float tmp_input[] = { 1.0f };
+
+  g_autofree gchar *config = get_config_path ("config_cascade_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  tdata = _create_test_data (TRUE);
+  ASSERT_TRUE (tdata != NULL);
+
+  status = ml_service_set_event_cb (handle, _extension_test_cascade_cb, tdata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_get_input_information (handle, NULL, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_create (info, &input);
+
+  /* Low-confidence input goes to the last stage. */
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_usleep (50000U);
+
+  /* High-confidence input exits at the first stage. */
+  tmp_input[0] = 3.0f;
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (tdata->received < 2 && tried++ < 10);
+
+  EXPECT_EQ (tdata->received, 2);
+
+  status = ml_service_get_information (handle, "cascade_inputs", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cascade_exit_0", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cascade_exit_add_large", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "cascade_exit_2", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  /* Clear callback before releasing tdata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+  _free_test_data (tdata);
+}
+
+/**
+ * @brief Usage of ml-service extension API with the variants of model.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, scenarioConfigVariantAdd)
+{
+  extension_test_data_s *tdata;
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  int i, status, tried;
+  gchar *value;
+  float tmp_input[] = { 1.0f };
+
+  g_autofree gchar *config = get_config_path ("config_variant_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  tdata = _create_test_data (FALSE);
+  ASSERT_TRUE (tdata != NULL);
+
+  status = ml_service_set_event_cb (handle, _extension_test_add_cb, tdata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_get_input_information (handle, NULL, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_create (info, &input);
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+
+  /* The queue depth does not exceed the SLO, the first variant processes all requests. */
+  for (i = 0; i < 3; i++) {
+    g_usleep (50000U);
+
+    status = ml_service_request (handle, NULL, input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (tdata->received < 3 && tried++ < 10);
+
+  EXPECT_EQ (tdata->received, 3);
+
+  status = ml_service_get_information (handle, "variant_current", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "add_full");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_switches", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_requests_add_full", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "3");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_time_1", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_time_add_unknown", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  /* Clear callback before releasing tdata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+  _free_test_data (tdata);
+}
+
 /**
  * @brief Testcase with invalid param.
  */
@@ -550,33 +1024,123 @@ TEST (MLServiceExtension, createConfigInvalidParam02_n)
   ml_service_h handle;
   int status;
 
-  status = ml_service_new ("", &handle);
+  status = ml_service_new ("", &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam03_n)
+{
+  int status;
+
+  g_autofree gchar *config = get_config_path ("config_single_add.conf");
+
+  status = ml_service_new (config, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST (MLServiceExtension, createConfigInvalidParam04_n)
+{
+  ml_service_h handle;
+  int status;
+
+  /* The configuration file does not exist. */
+  g_autofree gchar *config = get_config_path ("invalid_path.conf");
+
+  status = ml_service_new (config, &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST (MLServiceExtension, createConfigInvalidParam05_n)
+{
+  ml_service_h handle;
+  int status;
+
+  /* The configuration file has invalid tensor information. */
+  g_autofree gchar *config = get_config_path ("config_single_imgclf_invalid_info.conf");
+
+  status = ml_service_new (config, &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST (MLServiceExtension, createConfigInvalidParam06_n)
+{
+  ml_service_h handle;
+  int status;
+
+  /* The configuration file has invalid type. */
+  g_autofree gchar *config = get_config_path ("config_unknown_type.conf");
+
+  status = ml_service_new (config, &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST (MLServiceExtension, createConfigInvalidParam07_n)
+{
+  ml_service_h handle;
+  int status;
+
+  /* The configuration file does not have model file. */
+  g_autofree gchar *config = get_config_path ("config_single_no_model.conf");
+
+  status = ml_service_new (config, &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST (MLServiceExtension, createConfigInvalidParam08_n)
+{
+  ml_service_h handle;
+  int status;
+
+  /* The configuration file has invalid information. */
+  g_autofree gchar *config = get_config_path ("config_pipeline_invalid_info.conf");
+
+  status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Testcase with invalid param.
  */
-TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam03_n)
+TEST (MLServiceExtension, createConfigInvalidParam09_n)
 {
+  ml_service_h handle;
   int status;
 
-  g_autofree gchar *config = get_config_path ("config_single_add.conf");
+  /* The configuration file does not have node information. */
+  g_autofree gchar *config = get_config_path ("config_pipeline_no_info.conf");
 
-  status = ml_service_new (config, NULL);
+  status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam04_n)
+TEST (MLServiceExtension, createConfigInvalidParam10_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file does not exist. */
-  g_autofree gchar *config = get_config_path ("invalid_path.conf");
+  /* The configuration file has duplicated node name. */
+  g_autofree gchar *config = get_config_path ("config_pipeline_duplicated_name.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -585,13 +1149,13 @@ TEST (MLServiceExtension, createConfigInvalidParam04_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam05_n)
+TEST (MLServiceExtension, createConfigInvalidParam11_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file has invalid tensor information. */
-  g_autofree gchar *config = get_config_path ("config_single_imgclf_invalid_info.conf");
+  /* The configuration file does not have node name. */
+  g_autofree gchar *config = get_config_path ("config_pipeline_no_name.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -600,13 +1164,13 @@ TEST (MLServiceExtension, createConfigInvalidParam05_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam06_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam12_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file has invalid type. */
-  g_autofree gchar *config = get_config_path ("config_unknown_type.conf");
+  /* The input node should be defined before the node in the graph. */
+  g_autofree gchar *config = get_config_path ("config_graph_invalid_input.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -615,13 +1179,13 @@ TEST (MLServiceExtension, createConfigInvalidParam06_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam07_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam13_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file does not have model file. */
-  g_autofree gchar *config = get_config_path ("config_single_no_model.conf");
+  /* The stage in the cascade should have the exit rule except the last stage. */
+  g_autofree gchar *config = get_config_path ("config_cascade_invalid_exit.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -630,13 +1194,13 @@ TEST (MLServiceExtension, createConfigInvalidParam07_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam08_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam14_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file has invalid information. */
-  g_autofree gchar *config = get_config_path ("config_pipeline_invalid_info.conf");
+  /* The variants should have the SLO to switch the model. */
+  g_autofree gchar *config = get_config_path ("config_variant_invalid_slo.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -645,13 +1209,13 @@ TEST (MLServiceExtension, createConfigInvalidParam08_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam09_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam15_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file does not have node information. */
-  g_autofree gchar *config = get_config_path ("config_pipeline_no_info.conf");
+  /* The max bytes of the result cache should not be negative. */
+  g_autofree gchar *config = get_config_path ("config_single_add_cache_invalid.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -660,13 +1224,13 @@ TEST (MLServiceExtension, createConfigInvalidParam09_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam10_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam16_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file has duplicated node name. */
-  g_autofree gchar *config = get_config_path ("config_pipeline_duplicated_name.conf");
+  /* The queue depth of the SLO should not be negative. */
+  g_autofree gchar *config = get_config_path ("config_variant_invalid_depth.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -675,13 +1239,13 @@ TEST (MLServiceExtension, createConfigInvalidParam10_n)
 /**
  * @brief Testcase with invalid param.
  */
-TEST (MLServiceExtension, createConfigInvalidParam11_n)
+TEST_REQUIRE_TFLITE (MLServiceExtension, createConfigInvalidParam17_n)
 {
   ml_service_h handle;
   int status;
 
-  /* The configuration file does not have node name. */
-  g_autofree gchar *config = get_config_path ("config_pipeline_no_name.conf");
+  /* The threshold of the exit rule should be a number. */
+  g_autofree gchar *config = get_config_path ("config_cascade_invalid_threshold.conf");
 
   status = ml_service_new (config, &handle);
   EXPECT_NE (status, ML_ERROR_NONE);
@@ -1350,6 +1914,334 @@ TEST_REQUIRE_TFLITE (MLServiceExtension, requestMaxBuffer_n)
   ml_tensors_data_destroy (input);
 }
 
+/**
+ * @brief Internal structure to check the order of the requests.
+ */
+typedef struct {
+  gint received;
+  float outputs[16];
+} extension_test_order_s;
+
+/**
+ * @brief Callback function to keep the order of the outputs. The first request blocks the message thread for a while.
+ */
+static void
+_extension_test_order_cb (ml_service_event_e event, ml_information_h event_data, void *user_data)
+{
+  extension_test_order_s *odata = (extension_test_order_s *) user_data;
+  ml_tensors_data_h data = NULL;
+  void *_raw = NULL;
+  size_t _size = 0;
+  int status;
+
+  if (event != ML_SERVICE_EVENT_NEW_DATA)
+    return;
+
+  status = ml_information_get (event_data, "data", &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0U, &_raw, &_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  if (odata->received < 16)
+    odata->outputs[odata->received] = ((float *) _raw)[0];
+
+  /* Keep the message thread busy, so that the next requests are queued. */
+  if (odata->received == 0)
+    g_usleep (300000U);
+
+  g_atomic_int_inc (&odata->received);
+}
+
+/**
+ * @brief Usage of ml-service extension API with request priority.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, requestWithPriority)
+{
+  extension_test_data_s *tdata;
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input, input_high;
+  extension_test_order_s odata = { 0 };
+  char *value;
+  int i, status, tried;
+  float tmp_input[] = { 1.0f };
+  float high_input[] = { 5.0f };
+
+  g_autofree gchar *config = get_config_path ("config_single_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  tdata = _create_test_data (FALSE);
+  ASSERT_TRUE (tdata != NULL);
+
+  status = ml_service_set_event_cb (handle, _extension_test_add_cb, tdata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_service_get_input_information (handle, NULL, &info);
+  ml_tensors_data_create (info, &input);
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+
+  for (i = 0; i < 2; i++) {
+    status = ml_service_request_with_priority (
+        handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_LOW, 0U);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_service_request_with_priority (
+        handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_HIGH, 1000U);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (tdata->received < 4 && tried++ < 10);
+
+  EXPECT_EQ (tdata->received, 4);
+
+  status = ml_service_get_information (handle, "processed_high", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "processed_low", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "queue_depth_normal", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "dropped_high", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "latency_max_high", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (value);
+
+  /* The request of high priority is processed first, and the expired request is dropped. */
+  ml_tensors_data_create (info, &input_high);
+  ml_tensors_data_set_tensor_data (input_high, 0U, high_input, sizeof (float));
+
+  status = ml_service_set_event_cb (handle, _extension_test_order_cb, &odata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000U);
+
+  status = ml_service_request_with_priority (
+      handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_LOW, 0U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_service_request_with_priority (
+      handle, NULL, input_high, ML_SERVICE_REQUEST_PRIORITY_HIGH, 1000U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_service_request_with_priority (
+      handle, NULL, input_high, ML_SERVICE_REQUEST_PRIORITY_HIGH, 1U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (g_atomic_int_get (&odata.received) < 3 && tried++ < 20);
+
+  EXPECT_EQ (g_atomic_int_get (&odata.received), 3);
+  /* (input 5.0 + invoke 2.0) then (input 1.0 + invoke 2.0) */
+  EXPECT_EQ (odata.outputs[1], 7.0f);
+  EXPECT_EQ (odata.outputs[2], 3.0f);
+
+  status = ml_service_get_information (handle, "dropped_high", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  /* The request of high priority replaces the request of low priority in the full queue. */
+  status = ml_service_set_information (handle, "max_input", "2");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  odata.received = 0;
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000U);
+
+  for (i = 0; i < 2; i++) {
+    status = ml_service_request_with_priority (
+        handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_LOW, 0U);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_service_request_with_priority (
+      handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_LOW, 0U);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_request_with_priority (
+      handle, NULL, input_high, ML_SERVICE_REQUEST_PRIORITY_HIGH, 0U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (g_atomic_int_get (&odata.received) < 3 && tried++ < 20);
+
+  EXPECT_EQ (g_atomic_int_get (&odata.received), 3);
+  EXPECT_EQ (odata.outputs[1], 7.0f);
+
+  status = ml_service_get_information (handle, "dropped_low", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  /* Clear callback before releasing tdata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (input_high);
+  _free_test_data (tdata);
+}
+
+/**
+ * @brief Usage of ml-service extension API with the variants of model, switch the variant when the queue depth exceeds the SLO.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, scenarioConfigVariantSwitch)
+{
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  extension_test_order_s odata = { 0 };
+  gchar *value;
+  int i, status, tried;
+  float tmp_input[] = { 1.0f };
+
+  /* The SLO of queue depth is 2, and the variant is kept for 1 second before switching back. */
+  g_autofree gchar *config = get_config_path ("config_variant_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* The first output blocks the message thread, so that the next requests are queued. */
+  status = ml_service_set_event_cb (handle, _extension_test_order_cb, &odata);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_service_get_input_information (handle, NULL, &info);
+  ml_tensors_data_create (info, &input);
+  ml_tensors_data_set_tensor_data (input, 0U, tmp_input, sizeof (float));
+
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_usleep (50000U);
+
+  for (i = 0; i < 4; i++) {
+    status = ml_service_request (handle, NULL, input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (g_atomic_int_get (&odata.received) < 5 && tried++ < 30);
+
+  EXPECT_EQ (g_atomic_int_get (&odata.received), 5);
+
+  /* The queue depth exceeds the SLO, switch to the cheaper variant. */
+  status = ml_service_get_information (handle, "variant_current", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "add_lite");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_switches", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  /* The load is under the SLO after the hold time, switch back to the previous variant. */
+  g_usleep (1200000U);
+
+  status = ml_service_request (handle, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  tried = 0;
+  do {
+    g_usleep (30000U);
+  } while (g_atomic_int_get (&odata.received) < 6 && tried++ < 10);
+
+  EXPECT_EQ (g_atomic_int_get (&odata.received), 6);
+
+  status = ml_service_get_information (handle, "variant_current", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "add_full");
+  g_free (value);
+
+  status = ml_service_get_information (handle, "variant_switches", &value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  g_free (value);
+
+  /* Clear callback before releasing odata. */
+  status = ml_service_set_event_cb (handle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+}
+
+/**
+ * @brief Testcase with invalid param.
+ */
+TEST_REQUIRE_TFLITE (MLServiceExtension, requestWithPriorityInvalidParam_n)
+{
+  ml_service_h handle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h input;
+  char *value = NULL;
+  int status;
+
+  g_autofree gchar *config = get_config_path ("config_single_add.conf");
+
+  status = ml_service_new (config, &handle);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  ml_service_get_input_information (handle, NULL, &info);
+  ml_tensors_data_create (info, &input);
+
+  status = ml_service_request_with_priority (
+      NULL, NULL, input, ML_SERVICE_REQUEST_PRIORITY_HIGH, 0U);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_request_with_priority (
+      handle, NULL, NULL, ML_SERVICE_REQUEST_PRIORITY_HIGH, 0U);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_request_with_priority (
+      handle, NULL, input, ML_SERVICE_REQUEST_PRIORITY_MAX, 0U);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_get_information (handle, "queue_depth_invalid", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_get_information (handle, "invalid_high", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_service_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (input);
+}
+
 /**
  * @brief Main function to run the test.
  */
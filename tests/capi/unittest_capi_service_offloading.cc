@@ -8,6 +8,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <gio/gio.h>
 #include <glib/gstdio.h>
 #include <ml-api-inference-pipeline-internal.h>
 #include <ml-api-internal.h>
@@ -16,6 +17,7 @@
 
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <nnstreamer-edge.h>
 
 #include "ml-api-service-offloading.h"
 #include "nnstreamer.h"
@@ -40,6 +42,7 @@ class MLOffloadingService : public ::testing::Test
   ml_service_h client_h;
   ml_service_h server_h;
   _ml_service_test_data_s test_data;
+  guint port;
 
   /**
    * @brief Setup method for entire testsuite.
@@ -71,11 +74,11 @@ class MLOffloadingService : public ::testing::Test
    */
   void SetUp () override
   {
-    guint avail_port = get_available_port ();
+    port = get_available_port ();
     g_autofree gchar *receiver_config
-        = prepare_test_config ("service_offloading_receiver.conf", avail_port);
+        = prepare_test_config ("service_offloading_receiver.conf", port);
     g_autofree gchar *sender_config
-        = prepare_test_config ("service_offloading_sender.conf", avail_port);
+        = prepare_test_config ("service_offloading_sender.conf", port);
 
     int status = ml_service_new (receiver_config, &server_h);
     ASSERT_EQ (status, ML_ERROR_NONE);
@@ -97,6 +100,35 @@ class MLOffloadingService : public ::testing::Test
     EXPECT_EQ (ML_ERROR_NONE, status);
     status = ml_service_destroy (client_h);
     EXPECT_EQ (ML_ERROR_NONE, status);
+
+    remove_blobs ();
+  }
+
+  /**
+   * @brief Remove the blobs which the receiver keeps in the model directory.
+   */
+  static void remove_blobs ()
+  {
+    const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+    const gchar *name;
+    GDir *dir;
+
+    if (root_path == NULL)
+      return;
+
+    g_autofree gchar *blob_dir = g_build_filename (
+        root_path, "tests", "test_models", "models", ".blobs", NULL);
+    dir = g_dir_open (blob_dir, 0, NULL);
+    if (dir == NULL)
+      return;
+
+    while ((name = g_dir_read_name (dir)) != NULL) {
+      g_autofree gchar *blob_path = g_build_filename (blob_dir, name, NULL);
+      g_remove (blob_path);
+    }
+
+    g_dir_close (dir);
+    g_rmdir (blob_dir);
   }
 };
 
@@ -402,6 +434,166 @@ TEST_F (MLOffloadingService, registerModelURI)
   EXPECT_EQ (ML_ERROR_NONE, status);
 }
 
+/**
+ * @brief Structure for the http server to test model download.
+ */
+typedef struct {
+  gchar *body;
+  gsize len;
+  gint body_responses;
+  gint not_modified;
+} _http_server_data_s;
+
+/**
+ * @brief Handler of the http server, which supports ETag and range request.
+ */
+static gboolean
+_http_server_run_cb (GThreadedSocketService *service,
+    GSocketConnection *connection, GObject *source_object, gpointer user_data)
+{
+  _http_server_data_s *server = (_http_server_data_s *) user_data;
+  GInputStream *in = g_io_stream_get_input_stream (G_IO_STREAM (connection));
+  GOutputStream *out = g_io_stream_get_output_stream (G_IO_STREAM (connection));
+  g_autoptr (GDataInputStream) din = g_data_input_stream_new (in);
+  g_autofree gchar *response = NULL;
+  gboolean head = FALSE, not_modified = FALSE, range = FALSE;
+  guint64 start = 0, end = server->len - 1;
+  gchar *line;
+
+  while ((line = g_data_input_stream_read_line (din, NULL, NULL, NULL))) {
+    g_strstrip (line);
+
+    if (*line == '\0') {
+      g_free (line);
+      break;
+    }
+
+    if (g_str_has_prefix (line, "HEAD "))
+      head = TRUE;
+    else if (g_ascii_strncasecmp (line, "If-None-Match:", 14) == 0)
+      not_modified = (strstr (line, "\"v1\"") != NULL);
+    else if (g_ascii_strncasecmp (line, "Range: bytes=", 13) == 0)
+      range = (sscanf (line + 13, "%" G_GUINT64_FORMAT "-%" G_GUINT64_FORMAT,
+                   &start, &end) == 2);
+
+    g_free (line);
+  }
+
+  if (not_modified) {
+    g_atomic_int_inc (&server->not_modified);
+    response = g_strdup ("HTTP/1.1 304 Not Modified\r\nETag: \"v1\"\r\n"
+                         "Content-Length: 0\r\nConnection: close\r\n\r\n");
+  } else if (range) {
+    response = g_strdup_printf ("HTTP/1.1 206 Partial Content\r\nETag: \"v1\"\r\n"
+                                "Content-Range: bytes %" G_GUINT64_FORMAT
+                                "-%" G_GUINT64_FORMAT "/%" G_GSIZE_FORMAT "\r\n"
+                                "Content-Length: %" G_GUINT64_FORMAT "\r\n"
+                                "Connection: close\r\n\r\n",
+        start, end, server->len, end - start + 1);
+  } else {
+    response = g_strdup_printf ("HTTP/1.1 200 OK\r\nETag: \"v1\"\r\n"
+                                "Accept-Ranges: bytes\r\n"
+                                "Content-Length: %" G_GSIZE_FORMAT "\r\n"
+                                "Connection: close\r\n\r\n",
+        server->len);
+  }
+
+  g_output_stream_write_all (out, response, strlen (response), NULL, NULL, NULL);
+
+  if (!head && !not_modified) {
+    if (!range)
+      g_atomic_int_inc (&server->body_responses);
+
+    g_output_stream_write_all (out, server->body + start, end - start + 1,
+        NULL, NULL, NULL);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief use case of model registration from http URI, the unchanged model should not be downloaded again.
+ */
+TEST_F (MLOffloadingService, registerModelURICache)
+{
+  int status, i;
+  guint port;
+  ml_tensors_data_h input = NULL;
+  GSocketService *service;
+  _http_server_data_s server = { 0 };
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* _ml_service_offloading_request() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *test_model
+      = g_build_filename (model_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  EXPECT_TRUE (g_file_get_contents (test_model, &server.body, &server.len, NULL));
+
+  g_autofree gchar *cache_dir = g_dir_make_tmp ("ml-offloading-cache-XXXXXX", NULL);
+  ASSERT_TRUE (cache_dir != NULL);
+
+  port = get_available_port ();
+  service = g_threaded_socket_service_new (2);
+  EXPECT_TRUE (g_socket_listener_add_inet_port (
+      G_SOCKET_LISTENER (service), (guint16) port, NULL, NULL));
+  g_signal_connect (service, "run", G_CALLBACK (_http_server_run_cb), &server);
+  g_socket_service_start (service);
+
+  test_data.data = server.body;
+  status = ml_service_set_event_cb (server_h, _ml_service_event_cb, &test_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_service_set_information (server_h, "cache-dir", cache_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_autofree gchar *model_uri
+      = g_strdup_printf ("http://127.0.0.1:%u/mobilenet_v1_1.0_224_quant.tflite", port);
+  status = _create_tensor_data_from_str (model_uri, strlen (model_uri) + 1, &input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* Register same model twice, the second request should be revalidated with the cache. */
+  for (i = 0; i < 2; i++) {
+    status = ml_service_request (client_h, "model_registration_uri", input);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+
+    /* Wait for the server to register and check the result. */
+    g_usleep (1000000);
+  }
+
+  EXPECT_EQ (g_atomic_int_get (&server.body_responses), 1);
+  EXPECT_GE (g_atomic_int_get (&server.not_modified), 1);
+
+  status = ml_service_model_delete ("model_registration_test_key", 0U);
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  g_socket_service_stop (service);
+  g_socket_listener_close (G_SOCKET_LISTENER (service));
+  g_object_unref (service);
+  g_free (server.body);
+
+  {
+    const gchar *file_name;
+    GDir *dir = g_dir_open (cache_dir, 0, NULL);
+
+    while (dir && (file_name = g_dir_read_name (dir))) {
+      g_autofree gchar *file_path = g_build_filename (cache_dir, file_name, NULL);
+      g_remove (file_path);
+    }
+
+    if (dir)
+      g_dir_close (dir);
+    g_rmdir (cache_dir);
+  }
+}
+
 /**
  * @brief use case of model registration using ml offloading service.
  */
@@ -450,6 +642,578 @@ TEST_F (MLOffloadingService, registerModelPath)
   EXPECT_EQ (ML_ERROR_NONE, status);
 }
 
+/**
+ * @brief use case of model registration with the model file sent in chunks.
+ */
+TEST_F (MLOffloadingService, registerModelChunked)
+{
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* _ml_service_offloading_request() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *test_model
+      = g_build_filename (model_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+
+  g_autofree gchar *contents = NULL;
+  gsize len = 0;
+  EXPECT_TRUE (g_file_get_contents (test_model, &contents, &len, NULL));
+
+  test_data.data = contents;
+  status = ml_service_set_event_cb (server_h, _ml_service_event_cb, &test_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Send the model file in 64 KiB chunks. */
+  status = ml_service_set_information (client_h, "chunk-size", "65536");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* Wait for the server to register and check the result. */
+  g_usleep (1000000);
+
+  status = ml_service_model_delete ("model_registration_test_key", 0U);
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+}
+
+/**
+ * @brief Structure to count the registered models.
+ */
+typedef struct {
+  _ml_service_test_data_s *test_data;
+  guint registered;
+} _ml_service_dedup_data_s;
+
+/**
+ * @brief Callback function to count the registered models.
+ */
+static void
+_ml_service_dedup_event_cb (ml_service_event_e event, ml_information_h event_data, void *user_data)
+{
+  _ml_service_dedup_data_s *dedup_data = (_ml_service_dedup_data_s *) user_data;
+
+  if ((int) event == ML_SERVICE_EVENT_MODEL_REGISTERED)
+    dedup_data->registered++;
+
+  _ml_service_event_cb (event, event_data, dedup_data->test_data);
+}
+
+/**
+ * @brief Test to register the same model twice, the receiver registers the model with existing file.
+ */
+TEST_F (MLOffloadingService, registerModelDedup)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* _ml_service_offloading_request() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *test_model
+      = g_build_filename (model_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+
+  g_autofree gchar *contents = NULL;
+  gsize len = 0;
+  EXPECT_TRUE (g_file_get_contents (test_model, &contents, &len, NULL));
+
+  test_data.data = contents;
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_set_information (client_h, "dedup-timeout", "1000");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The receiver does not have the model, the sender sends the model file. */
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  g_usleep (1000000);
+  EXPECT_EQ (dedup_data.registered, 1U);
+
+  /* The receiver registers the model with the kept blob, without receiving the model file. */
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  g_usleep (1000000);
+  EXPECT_EQ (dedup_data.registered, 2U);
+
+  /* The blob is kept in the model directory. */
+  g_autofree gchar *hash = g_compute_checksum_for_data (G_CHECKSUM_SHA256, (const guchar *) contents, len);
+  g_autofree gchar *blob_path = g_build_filename (model_dir, ".blobs", hash, NULL);
+  EXPECT_TRUE (g_file_test (blob_path, G_FILE_TEST_IS_REGULAR));
+
+  /* The model file is still linked with the blob, the receiver keeps the blob. */
+  status = ml_service_model_delete ("model_registration_test_key", 0U);
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+  EXPECT_TRUE (g_file_test (blob_path, G_FILE_TEST_IS_REGULAR));
+}
+
+/**
+ * @brief Send the edge data with given information to the receiver, as the peer which does not use ml-service.
+ * @param info The pairs of the key and value, terminated by NULL.
+ */
+static int
+_send_raw_edge_data (guint port, const gchar **info, const gchar *payload)
+{
+  nns_edge_h edge_h = NULL;
+  nns_edge_data_h data_h = NULL;
+  g_autofree gchar *port_str = g_strdup_printf ("%u", get_available_port ());
+  guint i;
+  int ret;
+
+  ret = nns_edge_create_handle ("raw_sender", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  nns_edge_set_info (edge_h, "HOST", "127.0.0.1");
+  nns_edge_set_info (edge_h, "PORT", port_str);
+
+  ret = nns_edge_start (edge_h);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_connect (edge_h, "127.0.0.1", port);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_data_create (&data_h);
+
+  for (i = 0; ret == NNS_EDGE_ERROR_NONE && info[i] && info[i + 1]; i += 2)
+    ret = nns_edge_data_set_info (data_h, info[i], info[i + 1]);
+
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_data_add (data_h, (void *) payload, strlen (payload) + 1, NULL);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_send (edge_h, data_h);
+
+  /* Wait for the receiver to process the data before closing the connection. */
+  g_usleep (1000000);
+
+  if (data_h)
+    nns_edge_data_destroy (data_h);
+  nns_edge_release_handle (edge_h);
+  return ret;
+}
+
+/**
+ * @brief Test to probe the content with the hash which is not SHA-256 string, the receiver should not use it as the path of the blob.
+ */
+TEST_F (MLOffloadingService, contentProbeInvalidHash_n)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* The receiver requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *blob_dir = g_build_filename (model_dir, ".blobs", NULL);
+  g_autofree gchar *received_model
+      = g_build_filename (model_dir, "received_invalid_hash.tflite", NULL);
+  EXPECT_EQ (g_mkdir_with_parents (blob_dir, 0755), 0);
+
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The hash points the model file out of the blob directory. */
+  const gchar *info[] = { "service-type", "content_probe", "target-type",
+    "model_raw", "service-key", "model_registration_test_key", "name",
+    "received_invalid_hash.tflite", "activate", "true", "description",
+    "invalid content hash", "content-hash", "../mobilenet_v1_1.0_224_quant.tflite",
+    "probe-id", "invalid-hash-probe", NULL };
+
+  status = _send_raw_edge_data (port, info, "invalid-hash-probe");
+  EXPECT_EQ (status, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (dedup_data.registered, 0U);
+  EXPECT_FALSE (g_file_test (received_model, G_FILE_TEST_EXISTS));
+
+  g_remove (received_model);
+}
+
+/**
+ * @brief Test to send the chunk with the transfer id which is not alphanumeric token, the receiver should not use it in the name of the temporary file.
+ */
+TEST_F (MLOffloadingService, receiveChunkInvalidTransferId_n)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+  const gchar *payload = "invalid transfer id";
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* The receiver requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *received_model
+      = g_build_filename (model_dir, "received_invalid_transfer.tflite", NULL);
+  g_autofree gchar *total = g_strdup_printf ("%zu", strlen (payload) + 1);
+  g_autofree gchar *checksum = g_compute_checksum_for_data (
+      G_CHECKSUM_SHA256, (const guchar *) payload, strlen (payload) + 1);
+
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  const gchar *info[] = { "service-type", "model_raw", "service-key",
+    "model_registration_test_key", "name", "received_invalid_transfer.tflite",
+    "activate", "true", "description", "invalid transfer id", "transfer-id",
+    "../../invalid", "chunk-offset", "0", "total-size", total,
+    "chunk-checksum", checksum, "content-hash", checksum, NULL };
+
+  status = _send_raw_edge_data (port, info, payload);
+  EXPECT_EQ (status, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (dedup_data.registered, 0U);
+  EXPECT_FALSE (g_file_test (received_model, G_FILE_TEST_EXISTS));
+
+  g_remove (received_model);
+}
+
+/**
+ * @brief Test to register the model without deduplication, the receiver does not keep the blob.
+ */
+TEST_F (MLOffloadingService, registerModelNoDedup)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* _ml_service_offloading_request() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *test_model
+      = g_build_filename (model_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+
+  g_autofree gchar *contents = NULL;
+  gsize len = 0;
+  EXPECT_TRUE (g_file_get_contents (test_model, &contents, &len, NULL));
+
+  test_data.data = contents;
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  g_usleep (1000000);
+  EXPECT_EQ (dedup_data.registered, 1U);
+
+  g_autofree gchar *hash = g_compute_checksum_for_data (G_CHECKSUM_SHA256, (const guchar *) contents, len);
+  g_autofree gchar *blob_path = g_build_filename (model_dir, ".blobs", hash, NULL);
+  EXPECT_FALSE (g_file_test (blob_path, G_FILE_TEST_EXISTS));
+
+  status = ml_service_model_delete ("model_registration_test_key", 0U);
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test to register the model with the delta against the model the receiver has.
+ */
+TEST_F (MLOffloadingService, registerModelDelta)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* _ml_service_offloading_request() requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *test_model
+      = g_build_filename (model_dir, "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  g_autofree gchar *updated_model
+      = g_build_filename (g_get_tmp_dir (), "mobilenet_v1_1.0_224_quant_updated.tflite", NULL);
+
+  g_autofree gchar *contents = NULL;
+  gsize len = 0;
+  EXPECT_TRUE (g_file_get_contents (test_model, &contents, &len, NULL));
+
+  /* Update a few blocks of the model. */
+  g_autofree gchar *updated = (gchar *) g_malloc (len);
+  memcpy (updated, contents, len);
+  updated[len / 2] = ~updated[len / 2];
+  updated[len - 1] = ~updated[len - 1];
+  EXPECT_TRUE (g_file_set_contents (updated_model, updated, len, NULL));
+
+  test_data.data = contents;
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The receiver keeps the model as the base of the delta. */
+  status = ml_service_set_information (client_h, "dedup-timeout", "1000");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  g_usleep (1000000);
+  EXPECT_EQ (dedup_data.registered, 1U);
+
+  /* The receiver rebuilds the updated model with the model it received. */
+  test_data.data = updated;
+  status = _ml_service_offloading_request_file_delta (
+      client_h, "model_registration_raw", updated_model, test_model);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  g_usleep (1000000);
+  EXPECT_EQ (dedup_data.registered, 2U);
+
+  status = ml_service_model_delete ("model_registration_test_key", 0U);
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+
+  g_remove (updated_model);
+}
+
+/**
+ * @brief Test to send the delta with the base hash which is not SHA-256 string, the receiver should not use it as the path of the base model.
+ */
+TEST_F (MLOffloadingService, registerModelDeltaInvalidBase_n)
+{
+  int status;
+  _ml_service_dedup_data_s dedup_data;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* The receiver requires absolute path to model, ignore this case. */
+  if (root_path == NULL)
+    return;
+
+  g_autofree gchar *model_dir
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  g_autofree gchar *blob_dir = g_build_filename (model_dir, ".blobs", NULL);
+  g_autofree gchar *received_model
+      = g_build_filename (model_dir, "received_invalid_base.tflite", NULL);
+  EXPECT_EQ (g_mkdir_with_parents (blob_dir, 0755), 0);
+
+  dedup_data.test_data = &test_data;
+  dedup_data.registered = 0U;
+  status = ml_service_set_event_cb (server_h, _ml_service_dedup_event_cb, &dedup_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_service_offloading_set_information (server_h, "path", model_dir);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The base hash points the model file out of the blob directory, the bitmap (1 byte) has no changed block. */
+  const gchar *info[] = { "service-type", "model_raw", "service-key",
+    "model_registration_test_key", "name", "received_invalid_base.tflite",
+    "activate", "true", "description", "invalid delta base", "delta-base",
+    "../mobilenet_v1_1.0_224_quant.tflite", "delta-block-size", "4096",
+    "total-size", "4096", "content-hash",
+    "0000000000000000000000000000000000000000000000000000000000000000", NULL };
+
+  status = _send_raw_edge_data (port, info, "");
+  EXPECT_EQ (status, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (dedup_data.registered, 0U);
+  EXPECT_FALSE (g_file_test (received_model, G_FILE_TEST_EXISTS));
+
+  g_remove (received_model);
+}
+
+/**
+ * @brief Test to request the delta with invalid param.
+ */
+TEST_F (MLOffloadingService, requestFileDelta_n)
+{
+  int status;
+
+  status = _ml_service_offloading_request_file_delta (
+      NULL, "model_registration_raw", "/tmp/model", "/tmp/base");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = _ml_service_offloading_request_file_delta (
+      client_h, "model_registration_raw", "/tmp/model", NULL);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+}
+
+/**
+ * @brief Test to register the pipeline with compressed payload.
+ */
+TEST_F (MLOffloadingService, registerPipelineCompressed)
+{
+  int status;
+  ml_tensors_data_h input = NULL;
+  gchar *value = NULL;
+
+  /* Long enough description to be compressed. */
+  GString *desc = g_string_new ("fakesrc");
+  for (guint i = 0; i < 512; i++)
+    g_string_append (desc, " ! queue");
+  g_string_append (desc, " ! fakesink");
+
+  g_autofree gchar *pipeline_desc = g_string_free (desc, FALSE);
+  test_data.data = pipeline_desc;
+  status = ml_service_set_event_cb (server_h, _ml_service_event_cb, &test_data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_set_information (client_h, "compression", "zlib");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The received data is processed in the edge callback by default. */
+  status = ml_service_set_information (server_h, "workers", "2");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _create_tensor_data_from_str (pipeline_desc, strlen (pipeline_desc) + 1, &input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_request (client_h, "pipeline_registration_raw", input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  /* Wait for the server to register and check the result. */
+  g_usleep (1000000);
+
+  status = ml_service_get_information (client_h, "compression_count", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_get_information (client_h, "compression_ratio", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_GT (g_ascii_strtod (value, NULL), 1.0);
+  g_free (value);
+
+  status = ml_service_get_information (server_h, "decompression_count", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  /* The received data is processed by the worker. */
+  status = ml_service_get_information (server_h, "processed_pipeline_raw", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "1");
+  g_free (value);
+
+  status = ml_service_get_information (server_h, "queue_depth", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_pipeline_delete ("pipeline_registration_test_key");
+  EXPECT_TRUE (status == ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+}
+
+/**
+ * @brief Test to register the pipeline with compressed payload, the receiver drops the payload larger than the max raw size.
+ */
+TEST_F (MLOffloadingService, registerPipelineCompressedExceedMax_n)
+{
+  int status;
+  ml_tensors_data_h input = NULL;
+  gchar *value = NULL;
+  gchar *pipeline = NULL;
+
+  /* Long enough description to be compressed. */
+  GString *desc = g_string_new ("fakesrc");
+  for (guint i = 0; i < 512; i++)
+    g_string_append (desc, " ! queue");
+  g_string_append (desc, " ! fakesink");
+
+  g_autofree gchar *pipeline_desc = g_string_free (desc, FALSE);
+
+  status = ml_service_set_information (client_h, "compression", "zlib");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_set_information (server_h, "max-raw-size", "1024");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = _create_tensor_data_from_str (pipeline_desc, strlen (pipeline_desc) + 1, &input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_request (client_h, "pipeline_registration_raw", input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  g_usleep (1000000);
+
+  /* The receiver does not decompress and register the pipeline. */
+  status = ml_service_get_information (server_h, "decompression_count", &value);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+  EXPECT_STREQ (value, "0");
+  g_free (value);
+
+  status = ml_service_pipeline_get ("pipeline_registration_test_key", &pipeline);
+  EXPECT_NE (ML_ERROR_NONE, status);
+  g_free (pipeline);
+
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+}
+
+/**
+ * @brief Test to set invalid chunk size.
+ */
+TEST_F (MLOffloadingService, setChunkSizeInvalidParam_n)
+{
+  int status;
+
+  status = ml_service_set_information (client_h, "chunk-size", "invalid");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (server_h, "download-parallel", "0");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (client_h, "dedup-timeout", "-1");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (client_h, "compression", "lzma");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (server_h, "max-raw-size", "0");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (server_h, "coalesce", "0");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (server_h, "coalesce", "1024");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_set_information (server_h, "workers", "100");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = _ml_service_offloading_request_file (client_h, "model_registration_raw", "/invalid/path/model.tflite");
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+}
+
 /**
  * @brief use case of pipeline registration using ml offloading service using conf file.
  */
@@ -546,6 +1310,44 @@ TEST_F (MLOffloadingService, replyToClient)
   g_free (pipeline_desc);
 }
 
+/**
+ * @brief use case of replying to client with coalesced requests.
+ */
+TEST_F (MLOffloadingService, replyToClientCoalesced)
+{
+  int status;
+  ml_tensors_data_h input = NULL;
+  gint received = 0;
+  guint i;
+
+  const gchar *reply = "reply data";
+
+  status = _create_tensor_data_from_str (reply, strlen (reply) + 1, &input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_set_event_cb (client_h, _ml_service_reply_test_cb, &received);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Send 4 requests in an edge message, the last 2 requests are sent after the interval. */
+  status = ml_service_set_information (server_h, "coalesce", "4");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_service_set_information (server_h, "coalesce-interval", "50");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 10; i++) {
+    status = ml_service_request (server_h, "reply_to_client", input);
+    EXPECT_EQ (ML_ERROR_NONE, status);
+  }
+
+  /* Wait for the client to receive the replies. */
+  g_usleep (1000000);
+
+  EXPECT_EQ (received, 10);
+
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+}
+
 /**
  * @brief A tensor-sink callback for sink handle in a pipeline
  */
@@ -237,6 +237,175 @@ TEST_F (MLServiceTrainingOffloading, trainingOffloading_p)
   EXPECT_EQ (g_remove (sender_config), 0);
 }
 
+/**
+ * @brief Internal function to set the option node of training offloading in the config file. The node is consumed.
+ */
+static gboolean
+_set_training_option_node (const gchar *config, const gchar *name, JsonNode *node)
+{
+  g_autoptr (JsonParser) parser = json_parser_new ();
+  g_autoptr (JsonGenerator) generator = json_generator_new ();
+  JsonObject *object;
+
+  if (!json_parser_load_from_file (parser, config, NULL)) {
+    json_node_unref (node);
+    return FALSE;
+  }
+
+  object = json_node_get_object (json_parser_get_root (parser));
+  object = json_object_get_object_member (object, "offloading");
+  object = json_object_get_object_member (object, "training");
+  json_object_set_member (object, name, node);
+
+  json_generator_set_root (generator, json_parser_get_root (parser));
+  return json_generator_to_file (generator, config, NULL);
+}
+
+/**
+ * @brief Internal function to set the option of training offloading in the config file.
+ */
+static gboolean
+_set_training_option (const gchar *config, const gchar *name, gint64 value)
+{
+  return _set_training_option_node (config, name, json_node_init_int (json_node_alloc (), value));
+}
+
+/**
+ * @brief Test to send the training files concurrently, within the max size in flight.
+ */
+TEST_F (MLServiceTrainingOffloading, transferParallel_p)
+{
+  int status;
+  ml_service_h receiver_h;
+  ml_service_h sender_h;
+
+  GThread *start_thread = NULL;
+  GThread *receive_thread = NULL;
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  g_autofree gchar *file_path
+      = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  ASSERT_TRUE (g_file_test (file_path, G_FILE_TEST_IS_DIR));
+  g_autofree gchar *received_model = g_build_filename (file_path, "registered-mnist.bin", NULL);
+  g_autofree gchar *received_config = g_build_filename (file_path, "registered-mnist.ini", NULL);
+
+  g_remove (received_model);
+  g_remove (received_config);
+
+  guint avail_port = get_available_port ();
+  g_autofree gchar *receiver_config
+      = prepare_test_config ("training_offloading_receiver.conf", avail_port);
+  g_autofree gchar *sender_config
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+
+  /* The small max size in flight, each file is sent alone with 2 threads. */
+  ASSERT_TRUE (_set_training_option (sender_config, "transfer-parallel", 2));
+  ASSERT_TRUE (_set_training_option (sender_config, "max-inflight-size", 1));
+
+  status = ml_service_new (receiver_config, &receiver_h);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_new (sender_config, &sender_h);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_service_set_information (sender_h, "path", file_path);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_service_set_information (receiver_h, "path", file_path);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  start_thread = g_thread_new (
+      "sender_start_thread", (GThreadFunc) sender_start_thread, sender_h);
+  receive_thread = g_thread_new (
+      "receiver_start_thread", (GThreadFunc) receiver_start_thread, receiver_h);
+
+  /* All files should be received before the pipeline. */
+  int loop = 100;
+  while (loop--) {
+    if (g_file_test (received_model, G_FILE_TEST_EXISTS)
+        && g_file_test (received_config, G_FILE_TEST_EXISTS))
+      break;
+    g_usleep (100000);
+  }
+
+  EXPECT_TRUE (g_file_test (received_model, G_FILE_TEST_EXISTS));
+  EXPECT_TRUE (g_file_test (received_config, G_FILE_TEST_EXISTS));
+
+  ml_service_stop (sender_h);
+  ml_service_stop (receiver_h);
+
+  g_thread_join (start_thread);
+  g_thread_join (receive_thread);
+
+  status = ml_service_destroy (receiver_h);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  status = ml_service_destroy (sender_h);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  EXPECT_EQ (g_remove (receiver_config), 0);
+  EXPECT_EQ (g_remove (sender_config), 0);
+}
+
+/**
+ * @brief Test _ml_service_training_offloading_create with invalid options of the transfer.
+ */
+TEST_F (MLServiceTrainingOffloading, createInvalidParam3_n)
+{
+  int status;
+  ml_service_h receiver_h = NULL;
+  ml_service_h sender_h = NULL;
+
+  guint avail_port = get_available_port ();
+  g_autofree gchar *receiver_config
+      = prepare_test_config ("training_offloading_receiver.conf", avail_port);
+  g_autofree gchar *sender_config1
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+  g_autofree gchar *sender_config2
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+  g_autofree gchar *sender_config3
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+  g_autofree gchar *sender_config4
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+  g_autofree gchar *sender_config5
+      = prepare_test_config ("training_offloading_sender.conf", avail_port);
+
+  /* If you run the sender without running the receiver first, a connect error occurs in nns-edge. */
+  status = ml_service_new (receiver_config, &receiver_h);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  ASSERT_TRUE (_set_training_option (sender_config1, "transfer-parallel", 0));
+  status = ml_service_new (sender_config1, &sender_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  ASSERT_TRUE (_set_training_option (sender_config2, "max-inflight-size", -1));
+  status = ml_service_new (sender_config2, &sender_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  /* The options should be integers. */
+  ASSERT_TRUE (_set_training_option_node (sender_config3, "transfer-parallel",
+      json_node_init_string (json_node_alloc (), "2")));
+  status = ml_service_new (sender_config3, &sender_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  ASSERT_TRUE (_set_training_option_node (sender_config4, "max-inflight-size",
+      json_node_init_double (json_node_alloc (), 1.5)));
+  status = ml_service_new (sender_config4, &sender_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  ASSERT_TRUE (_set_training_option (sender_config5, "transfer-parallel", (gint64) G_MAXINT + 1));
+  status = ml_service_new (sender_config5, &sender_h);
+  EXPECT_EQ (ML_ERROR_INVALID_PARAMETER, status);
+
+  status = ml_service_destroy (receiver_h);
+  EXPECT_EQ (ML_ERROR_NONE, status);
+
+  EXPECT_EQ (g_remove (receiver_config), 0);
+  EXPECT_EQ (g_remove (sender_config1), 0);
+  EXPECT_EQ (g_remove (sender_config2), 0);
+  EXPECT_EQ (g_remove (sender_config3), 0);
+  EXPECT_EQ (g_remove (sender_config4), 0);
+  EXPECT_EQ (g_remove (sender_config5), 0);
+}
+
 /**
  * @brief Test _ml_service_training_offloading_create with invalid param.
  */